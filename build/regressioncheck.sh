@@ -0,0 +1,56 @@
+#!/bin/sh
+# Checks that the output of a generator doesn't depend on the number of threads or on --circumcircle-table.
+# The input is a random triangulation big enough to split the parallel phases in several chunks.
+if [ "$#" -lt 1 ];  then
+    echo "Usage: $0 <executable> [number of vertices] [threads] [extra options for every run]" >&2
+    exit 1
+fi
+
+executable="$(realpath "$1")"
+num_vertices="${2:-200000}"
+threads="${3:-4}"
+shift $(( $# < 3 ? $# : 3 ))
+
+file_folder="../data/"
+input="${file_folder}points${num_vertices}.1"
+output="${file_folder}regression${num_vertices}"
+
+if [ ! -f "${input}.node" ]; then
+    echo -n "Generating mesh with ${num_vertices} vertices..."
+    cd ../data
+    ./datagenerator.sh "${num_vertices}"
+    cd ../build
+    echo "done"
+fi
+
+run() {
+    "${executable}" --input1 "${input}.node" --input2 "${input}.ele" --input3 "${input}.neigh" --off-output --ale-output "$@" || exit 1
+}
+
+compare() {
+    for ext in off ale; do
+        if ! cmp -s "${output}_threads1.${ext}" "${output}_$1.${ext}"; then
+            echo "FAILED: .${ext} output of $1 differs from --threads 1"
+            failed=1
+        fi
+    done
+}
+
+failed=0
+echo -n "Running with 1 and ${threads} threads..."
+run -o "${output}_threads1" --threads 1 "$@"
+run -o "${output}_threads${threads}" --threads "${threads}" "$@"
+echo "done"
+compare "threads${threads}"
+
+if "${executable}" --help | grep -q -- "--circumcircle-table"; then
+    echo -n "Running with the circumcircle table..."
+    run -o "${output}_circumcircles" --threads "${threads}" --circumcircle-table "$@"
+    echo "done"
+    compare "circumcircles"
+fi
+
+if [ "${failed}" -ne 0 ]; then
+    exit 1
+fi
+echo "Outputs match"
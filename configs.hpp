@@ -17,29 +17,34 @@
     #ifndef TRIANGLE_COMPARATOR_SORT_PARAM_2
     #define TRIANGLE_COMPARATOR_SORT_PARAM_2 false
     #endif
-    #define TRIANGLE_COMPARATOR TRIANGLE_COMPARATOR_BASE_T<MESH_TYPE,TRIANGLE_COMPARATOR_ASCENDING,TRIANGLE_COMPARATOR_SORT_PARAM_2>
+    #define TRIANGLE_COMPARATOR_FOR(MESH) TRIANGLE_COMPARATOR_BASE_T<MESH,TRIANGLE_COMPARATOR_ASCENDING,TRIANGLE_COMPARATOR_SORT_PARAM_2>
 #else 
-    #define TRIANGLE_COMPARATOR TRIANGLE_COMPARATOR_BASE_T<MESH_TYPE>
+    #define TRIANGLE_COMPARATOR_FOR(MESH) TRIANGLE_COMPARATOR_BASE_T<MESH>
 #endif
+#define TRIANGLE_COMPARATOR TRIANGLE_COMPARATOR_FOR(MESH_TYPE)
 #ifndef MERGING_STRATEGY_T
 #define MERGING_STRATEGY_T ExcludePreviousCavitiesStrategy
 #endif
-#define MERGING_STRATEGY MERGING_STRATEGY_T<MESH_TYPE>
+#define MERGING_STRATEGY_FOR(MESH) MERGING_STRATEGY_T<MESH>
+#define MERGING_STRATEGY MERGING_STRATEGY_FOR(MESH_TYPE)
 #ifndef SELECTION_CRITERION_T
 #define SELECTION_CRITERION_T NullSelectionCriterion
 #endif
-#define SELECTION_CRITERION SELECTION_CRITERION_T<MESH_TYPE>
+#define SELECTION_CRITERION_FOR(MESH) SELECTION_CRITERION_T<MESH>
+#define SELECTION_CRITERION SELECTION_CRITERION_FOR(MESH_TYPE)
 #ifdef SELECTION_CRITERION_WITH_ARG
-    #define SELECTION_CRITERION_CONSTRUCTOR(ARG) SELECTION_CRITERION_T<MESH_TYPE>(ARG)
+    #define SELECTION_CRITERION_CONSTRUCTOR_FOR(MESH, ARG) SELECTION_CRITERION_T<MESH>(ARG)
+    #define SELECTION_CRITERION_CONSTRUCTOR(ARG) SELECTION_CRITERION_CONSTRUCTOR_FOR(MESH_TYPE, ARG)
 #endif
 #ifndef GENERATOR_T
 #define GENERATOR_T DelaunayCavityGenerator
 #endif
 #ifdef DELAUNAY_GENERATOR
-    #define MESH_GENERATOR GENERATOR_T<MESH_TYPE, SELECTION_CRITERION, TRIANGLE_COMPARATOR, MERGING_STRATEGY>
+    #define MESH_GENERATOR_FOR(MESH) GENERATOR_T<MESH, SELECTION_CRITERION_FOR(MESH), TRIANGLE_COMPARATOR_FOR(MESH), MERGING_STRATEGY_FOR(MESH)>
 #else
-    #define MESH_GENERATOR GENERATOR_T<MESH_TYPE> // Polylla
+    #define MESH_GENERATOR_FOR(MESH) GENERATOR_T<MESH> // Polylla
 #endif
+#define MESH_GENERATOR MESH_GENERATOR_FOR(MESH_TYPE)
 
 #define STRINGIFY(x) #x
 #define TOSTRING(x) STRINGIFY(x)
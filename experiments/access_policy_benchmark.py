@@ -0,0 +1,97 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+from pathlib import Path
+from statistics import mean
+
+working_dir = Path(os.path.dirname(os.path.realpath(__file__)))
+
+ACCESS_POLICIES = ["CheckedAccess", "UncheckedAccess"]
+PHASES = [
+    "t_triangle_sorting",
+    "t_cavity_computation",
+    "t_cavity_insertion",
+    "t_cavity_merging",
+    "t_total",
+]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Compare the per-phase running time of a generator built with checked and unchecked mesh access."
+    )
+    parser.add_argument("--target", type=str,
+                        default="delaunay_cavity_generator-half_edge_mesh-null_comparator-exclude_previous_cavities_strategy-null_selection_criterion",
+                        help="CMake target (executable) to benchmark.")
+    parser.add_argument("--points", type=int, default=1000000,
+                        help="Number of points of the input point sets.")
+    parser.add_argument("--seeds", type=int, nargs="+", default=[14, 43, 68, 70, 139],
+                        help="Seeds identifying which point set files to use.")
+    parser.add_argument("--repetitions", type=int, default=3,
+                        help="Runs per input and access policy.")
+    parser.add_argument("--input-dir", type=Path, default=working_dir / "../../delaunay-cavity-data/data",
+                        help="Directory with the points{n}.{seed}.node/.ele/.neigh files.")
+    parser.add_argument("--output-dir", type=Path, default=working_dir / "../../delaunay-cavity-data/experiments/access_policy",
+                        help="Directory where the json stats are written.")
+    parser.add_argument("--skip-build", action="store_true",
+                        help="Use the already built executables.")
+    return parser.parse_args()
+
+
+def build_dir_of(policy):
+    return working_dir / f"../build-{policy}"
+
+
+def build(policy, target):
+    build_dir = build_dir_of(policy)
+    os.makedirs(build_dir, exist_ok=True)
+    subprocess.run(["cmake", "-DCMAKE_BUILD_TYPE=Release", "-DBUILD_MACRO_COMBO=ON",
+                    f"-DMESH_ACCESS_POLICY={policy}", str(working_dir / "..")],
+                   cwd=build_dir, check=True)
+    subprocess.run(["cmake", "--build", ".", "--target", target], cwd=build_dir, check=True)
+
+
+def run(policy, target, name, repetition, input_dir, output_dir):
+    exec_name = target + (".exe" if "win" in sys.platform else "")
+    output_basename = output_dir / policy / f"{name}.{repetition}"
+    os.makedirs(output_basename.parent, exist_ok=True)
+    cmd_list = [build_dir_of(policy) / exec_name,
+                "--input1", input_dir / f"{name}.node",
+                "--input2", input_dir / f"{name}.ele",
+                "--input3", input_dir / f"{name}.neigh",
+                "--json-output", "--output", output_basename]
+    subprocess.run([str(x) for x in cmd_list], check=True, cwd=working_dir)
+    with open(f"{output_basename}.json", "r") as f:
+        return json.load(f)
+
+
+def main():
+    args = parse_args()
+    if not args.skip_build:
+        for policy in ACCESS_POLICIES:
+            build(policy, args.target)
+
+    results = {policy: {phase: [] for phase in PHASES} for policy in ACCESS_POLICIES}
+    for seed in args.seeds:
+        name = f"points{args.points}.{seed}"
+        for repetition in range(args.repetitions):
+            # Alternate the order so neither policy always runs on a warm cache
+            policies = ACCESS_POLICIES if repetition % 2 == 0 else list(reversed(ACCESS_POLICIES))
+            for policy in policies:
+                data = run(policy, args.target, name, repetition, args.input_dir, args.output_dir)
+                for phase in PHASES:
+                    results[policy][phase].append(data[phase])
+
+    checked, unchecked = ACCESS_POLICIES
+    print(f"{'phase':<24}{checked:>16}{unchecked:>16}{'speedup':>10}")
+    for phase in PHASES:
+        checked_time = mean(results[checked][phase])
+        unchecked_time = mean(results[unchecked][phase])
+        speedup = checked_time / unchecked_time if unchecked_time > 0 else float("nan")
+        print(f"{phase:<24}{checked_time:>16.3f}{unchecked_time:>16.3f}{speedup:>9.2f}x")
+
+
+if __name__ == "__main__":
+    main()
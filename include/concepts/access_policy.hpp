@@ -0,0 +1,17 @@
+#ifndef ACCESS_POLICY_CONCEPT_HPP
+#define ACCESS_POLICY_CONCEPT_HPP
+#include <concepts>
+#include <vector>
+#include <cstddef>
+
+/**
+ * An access policy decides how a mesh indexes its internal vectors, it must be able to
+ * return a reference to an element of both a mutable and a constant vector
+ */
+template <typename Policy>
+concept AccessPolicy = requires(std::vector<int>& vec, const std::vector<int>& cvec, size_t i) {
+    { Policy::get(vec, i) } -> std::same_as<int&>;
+    { Policy::get(cvec, i) } -> std::same_as<const int&>;
+};
+
+#endif
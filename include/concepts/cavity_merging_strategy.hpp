@@ -9,21 +9,21 @@
 
 template <typename MergingStrategy, typename Mesh>
 concept HasPreAddMethodPerCavity = requires(Mesh* mesh, 
-    const std::vector<generators::helpers::delaunay_cavity::Cavity<Mesh>>& cavities,
+    const generators::helpers::delaunay_cavity::CavitySet<Mesh>& cavities,
     typename Mesh::FaceIndex triangle) {
         { MergingStrategy::preAdd(mesh, triangle, cavities)} -> std::convertible_to<bool>;
 } && MeshData<Mesh>;
 
 template <typename MergingStrategy, typename Mesh>
 concept HasPreAddMethodByPresence = requires(Mesh* mesh, 
-    const std::vector<uint8_t>& inCavity,
+    const std::vector<typename DelaunayCavityData<Mesh>::CavityStamp>& inCavity,
     typename Mesh::FaceIndex triangle) {
         { MergingStrategy::preAdd(triangle, inCavity)} -> std::convertible_to<bool>;
 } && MeshData<Mesh>;
 
 template <typename MergingStrategy, typename Mesh>
 concept HasPostComputeMethod = requires(Mesh* mesh,
-    std::vector<generators::helpers::delaunay_cavity::Cavity<Mesh>>& cavities) {
+    generators::helpers::delaunay_cavity::CavitySet<Mesh>& cavities) {
         { MergingStrategy::postCompute(mesh, cavities)} -> std::same_as<void>;
 } && MeshData<Mesh>;
 
@@ -34,6 +34,14 @@ concept HasPostInsertionMethod =
         { MergingStrategy::postInsertion(inputMesh, outputMesh, generatorData)} -> std::same_as<void>;
 } && MeshData<Mesh>;
 
+/**
+ * A strategy whose cavities never share a triangle, so each cavity can be inserted independently of the others
+ */
+template <typename MergingStrategy, typename Mesh>
+concept HasDisjointCavities = requires {
+    requires MergingStrategy::disjointCavities;
+} && MeshData<Mesh>;
+
 /**
  * A cavity merging strategy must apply to a particular mesh that conforms to the MeshData concept,
  * and it must have either a preAdd method, postCompute method or postInsertion method
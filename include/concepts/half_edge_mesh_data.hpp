@@ -0,0 +1,45 @@
+#ifndef HALF_EDGE_MESH_DATA_HPP
+#define HALF_EDGE_MESH_DATA_HPP
+#include <concepts>
+#include <concepts/mesh_data.hpp>
+
+/**
+ * A half edge based Mesh type, besides being MeshData, can be navigated and updated through its half edges, so it must:
+ * - Be able to query the `origin`, `target`, `twin`, `next` and `prev` of a half edge
+ * - Rotate around the origin of a half edge in both directions
+ * - Query the face of an edge, the identifying edge of a face and an edge incident to a vertex
+ * - Update the `next`, `prev` and face of an edge, as well as the identifying edge of a face
+ *
+ * How the half edges are stored is up to the Mesh type, so generic half edge logic should only rely on these operations
+ */
+template <typename Mesh>
+concept HalfEdgeMeshData = MeshData<Mesh>
+    && requires(Mesh& mesh,
+                const Mesh& cmesh,
+                typename Mesh::VertexIndex v,
+                typename Mesh::EdgeIndex e,
+                typename Mesh::FaceIndex f) {
+        { cmesh.origin(e) } -> std::convertible_to<typename Mesh::VertexIndex>;
+        { cmesh.target(e) } -> std::convertible_to<typename Mesh::VertexIndex>;
+        { cmesh.twin(e) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.next(e) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.prev(e) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.CCWEdgeToVertex(e) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.CWEdgeToVertex(e) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.edgeOfVertex(v) } -> std::convertible_to<typename Mesh::EdgeIndex>;
+        { cmesh.degree(v) } -> std::convertible_to<unsigned int>;
+        { cmesh.getFaceOfEdge(e) } -> std::convertible_to<typename Mesh::FaceIndex>;
+        { mesh.setNext(e, e) } -> std::same_as<void>;
+        { mesh.setPrev(e, e) } -> std::same_as<void>;
+        { mesh.setFaceToEdge(f, e) } -> std::same_as<void>;
+        { mesh.setEdgeAsFace(f, e) } -> std::same_as<void>;
+    };
+
+/**
+ * Whether `setNext` and `setPrev` of a half edge Mesh type can be called concurrently for different edges,
+ * mesh types that store every link in its own slot specialize it right after their definition
+ */
+template <typename Mesh>
+inline constexpr bool hasConcurrentLinkUpdates = false;
+
+#endif // HALF_EDGE_MESH_DATA_HPP
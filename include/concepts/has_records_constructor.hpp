@@ -0,0 +1,18 @@
+#ifndef HAS_RECORDS_CONSTRUCTOR_HPP
+#define HAS_RECORDS_CONSTRUCTOR_HPP
+#include <concepts>
+#include <concepts/mesh_data.hpp>
+#include <mesh_data/structures/half_edge_mesh_records.hpp>
+
+/**
+ * A Mesh type has a records constructor if it can take its vertex, half edge and polygon arrays as they are,
+ * without building any connectivity
+ */
+template<typename Mesh>
+concept HasRecordsConstructor =
+    requires (HalfEdgeMeshRecords<typename Mesh::VertexType, typename Mesh::EdgeType, typename Mesh::FaceIndex> records) {
+        Mesh(std::move(records));
+    }
+    && MeshData<Mesh>;
+
+#endif
@@ -5,14 +5,16 @@
 /**
  * A Mesh type has getters for its vertices, edges and polygons.
  * 
- * Their count can also be queried
+ * Their count can also be queried. Vertices and edges may be returned either by reference or as a value
+ * assembled on the fly, for meshes that don't store them as a single record
  */
 template<typename Mesh>
 concept MeshAccessors =
     requires(Mesh& mesh, const Mesh& cmesh, typename Mesh::OutputIndex out,
     typename Mesh::VertexIndex vIdx, typename Mesh::EdgeIndex eIdx, typename Mesh::FaceIndex fIdx) {
-        { mesh.getVertex(vIdx) } -> std::same_as<typename Mesh::VertexType&>;
-        { mesh.getEdge(eIdx) } -> std::same_as<typename Mesh::EdgeType&>;
+        { mesh.getVertex(vIdx) } -> std::convertible_to<const typename Mesh::VertexType&>;
+        { mesh.getEdge(eIdx) } -> std::convertible_to<const typename Mesh::EdgeType&>;
+        { cmesh.getEdge(eIdx) } -> std::convertible_to<const typename Mesh::EdgeType&>;
         { mesh.getPolygon(fIdx) } -> std::same_as<typename Mesh::OutputIndex>;
         { cmesh.numberOfVertices()} -> std::convertible_to<size_t>;
         { cmesh.getVertexVectorSize()} -> std::convertible_to<size_t>;
@@ -3,19 +3,26 @@
 #include <concepts>
 #include <vector>
 #include <array>
+#include <ranges>
+#include <mesh_data/structures/vertex.hpp>
 
 /**
  * Topology operations for a Mesh type such as getting the neighboring triangles of a triangle, the edges of triangle and other queries
+ *
+ * `facesAround` and `edgesAroundVertex` are circulators, ranges that are traversed in place instead of being collected into a vector
  */
 template<typename Mesh>
 concept MeshTopology =
     requires(Mesh& mesh,
              const Mesh& cmesh,
-             typename Mesh::VertexType v,
+             Vertex v,
+             typename Mesh::VertexIndex vIdx,
              typename Mesh::EdgeIndex e,
              typename Mesh::FaceIndex f,
              typename Mesh::OutputIndex out) {
         { cmesh.getNeighbors(f) } -> std::same_as<std::vector<typename Mesh::FaceIndex>>;
+        { cmesh.facesAround(f) } -> std::ranges::input_range;
+        { cmesh.edgesAroundVertex(vIdx) } -> std::ranges::input_range;
         { cmesh.getVerticesOfTriangle(f, v, v, v)} -> std::same_as<void>;
         { cmesh.getEdgesOfTriangle(f) } -> std::same_as<std::array<typename Mesh::EdgeIndex,3>>;
         { cmesh.isBorderEdge(e) } -> std::same_as<bool>;
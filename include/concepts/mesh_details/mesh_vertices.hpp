@@ -4,10 +4,10 @@
 #include <mesh_data/structures/vertex.hpp>
 
 /**
- * A Mesh type must have a VertexType which in turn is a type of Vertex
+ * A Mesh type must have a VertexType which in turn is a type of Vertex, with coordinates of any floating point scalar
  */
 template <typename Mesh>
-concept MeshVertices = requires { typename Mesh::VertexType; }
-    && std::derived_from<typename Mesh::VertexType, Vertex>;
+concept MeshVertices = requires { typename Mesh::VertexType; typename Mesh::VertexType::Scalar; }
+    && std::derived_from<typename Mesh::VertexType, BasicVertex<typename Mesh::VertexType::Scalar>>;
 
 #endif // MESH_VERTICES_HPP
\ No newline at end of file
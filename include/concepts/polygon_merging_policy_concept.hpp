@@ -2,6 +2,7 @@
 #define POLYGON_MERGING_POLICY_CONCEPT_HPP
 #include <concepts>
 #include <concepts/mesh_data.hpp>
+#include <misc/edge_length_cache.hpp>
 
 template <typename MergingPolicy, MeshData Mesh>
 inline constexpr bool isNullMergingPolicy = false;
@@ -17,4 +18,19 @@ concept PolygonMergingPolicy = isNullMergingPolicy<MergingPolicy,Mesh> ||
         { MergingPolicy::mergeBestCandidate(mesh, seedToMerge, seedNeighbors, sharedEdges)} -> std::convertible_to<typename Mesh::OutputIndex>;
     };
 
+/**
+ * A merging policy that picks the neighbor by the length of the shared edges, which can also read them from an `EdgeLengthCache`
+ */
+template <typename MergingPolicy, typename Mesh>
+concept EdgeLengthMergingPolicy = PolygonMergingPolicy<MergingPolicy,Mesh> &&
+    requires(
+        Mesh* mesh,
+        const EdgeLengthCache<Mesh>& edgeLengths,
+        typename Mesh::OutputIndex seedToMerge,
+        std::vector<typename Mesh::OutputIndex>& seedNeighbors,
+        std::vector<std::vector<typename Mesh::EdgeIndex>>& sharedEdges
+    ) {
+        { MergingPolicy::mergeBestCandidate(mesh, edgeLengths, seedToMerge, seedNeighbors, sharedEdges)} -> std::convertible_to<typename Mesh::OutputIndex>;
+    };
+
 #endif // POLYGON_MERGING_POLICY_CONCEPT_HPP
\ No newline at end of file
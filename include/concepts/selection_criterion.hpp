@@ -2,6 +2,7 @@
 #define SELECTION_CRITERION_HPP
 #include <concepts>
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 
 template <typename Criterion, MeshData Mesh>
 inline constexpr bool isNullSelectionCriterion = false;
@@ -23,4 +24,22 @@ MeshData<Mesh>;
 template <typename Criterion, typename Mesh>
 concept SelectionCriterion = SelectionCriterionBase<Criterion,Mesh> || isNullSelectionCriterion<Criterion,Mesh>;
 
+/**
+ * A selection criterion that can also be evaluated from a `TriangleQualityCache` holding the `qualityMetrics` it reads
+ */
+template <typename Criterion, typename Mesh>
+concept CachedSelectionCriterion = requires(const Criterion criterion, const TriangleQualityCache& cache, typename Mesh::FaceIndex polygonIndex) {
+    {Criterion::qualityMetrics} -> std::convertible_to<unsigned int>;
+    {criterion(cache,polygonIndex)} -> std::convertible_to<bool>;
+} && SelectionCriterionBase<Criterion,Mesh>;
+
+/**
+ * Metrics the criterion reads from the quality cache, 0 if it can't be evaluated from it
+ */
+template <typename Criterion, typename Mesh>
+inline constexpr unsigned int criterionQualityMetrics = 0;
+
+template <typename Criterion, typename Mesh> requires CachedSelectionCriterion<Criterion,Mesh>
+inline constexpr unsigned int criterionQualityMetrics<Criterion,Mesh> = Criterion::qualityMetrics;
+
 #endif
\ No newline at end of file
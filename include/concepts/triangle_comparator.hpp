@@ -3,6 +3,7 @@
 #include <concepts>
 #include <vector>
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 
 template <typename Comparator, typename Mesh>
 inline constexpr bool isNullComparator = false;
@@ -10,12 +11,36 @@ inline constexpr bool isNullComparator = false;
 template <typename Comparator, typename Mesh>
 inline constexpr bool isRandomComparator = false;
 
+/**
+ * A comparator orders triangles by a non negative `key`, computed once per triangle, in ascending or descending order.
+ * `compare` must agree with ordering by `key`
+ */
 template <typename Comparator, typename Mesh>
 concept TriangleComparatorBase = requires(const Mesh* meshptr, const typename Mesh::FaceIndex& t1, const typename Mesh::FaceIndex& t2) {
     {Comparator::compare(meshptr,t1,t2)} -> std::same_as<bool>;
+    {Comparator::key(meshptr,t1)} -> std::same_as<double>;
+    {Comparator::ascending} -> std::convertible_to<bool>;
 } && MeshData<Mesh>;
 
 template <typename Comparator, typename Mesh>
 concept TriangleComparator = TriangleComparatorBase<Comparator, Mesh> || isNullComparator<Comparator,Mesh> || isRandomComparator<Comparator,Mesh>;
 
+/**
+ * A comparator whose `key` can also be read from a `TriangleQualityCache` holding the `qualityMetrics` it needs
+ */
+template <typename Comparator, typename Mesh>
+concept CachedTriangleComparator = requires(const TriangleQualityCache& cache, const typename Mesh::FaceIndex& t1) {
+    {Comparator::qualityMetrics} -> std::convertible_to<unsigned int>;
+    {Comparator::key(cache,t1)} -> std::same_as<double>;
+} && TriangleComparatorBase<Comparator, Mesh>;
+
+/**
+ * Metrics the comparator reads from the quality cache, 0 if it can't read its keys from it
+ */
+template <typename Comparator, typename Mesh>
+inline constexpr unsigned int comparatorQualityMetrics = 0;
+
+template <typename Comparator, typename Mesh> requires CachedTriangleComparator<Comparator,Mesh>
+inline constexpr unsigned int comparatorQualityMetrics<Comparator,Mesh> = Comparator::qualityMetrics;
+
 #endif // TRIANGLE_COMPARATOR_HPP
\ No newline at end of file
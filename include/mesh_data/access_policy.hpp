@@ -0,0 +1,41 @@
+#ifndef ACCESS_POLICY_HPP
+#define ACCESS_POLICY_HPP
+#include <cstddef>
+#include <concepts/access_policy.hpp>
+
+/**
+ * Bounds checked access through `at`, an invalid index throws `std::out_of_range`
+ */
+struct CheckedAccess {
+    template <typename Container>
+    static decltype(auto) get(Container& container, size_t i) {
+        return container.at(i);
+    }
+};
+
+/**
+ * Unchecked access through `operator[]`, an invalid index is undefined behavior
+ */
+struct UncheckedAccess {
+    template <typename Container>
+    static decltype(auto) get(Container& container, size_t i) {
+        return container[i];
+    }
+};
+
+static_assert(AccessPolicy<CheckedAccess>);
+static_assert(AccessPolicy<UncheckedAccess>);
+
+/**
+ * The access policy used by meshes when none is given, it can be set with the `MESH_ACCESS_POLICY` macro,
+ * otherwise debug builds check every access and builds with `NDEBUG` don't
+ */
+#if defined(MESH_ACCESS_POLICY)
+using DefaultAccessPolicy = MESH_ACCESS_POLICY;
+#elif defined(NDEBUG)
+using DefaultAccessPolicy = UncheckedAccess;
+#else
+using DefaultAccessPolicy = CheckedAccess;
+#endif
+
+#endif
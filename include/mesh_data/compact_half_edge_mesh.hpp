@@ -0,0 +1,210 @@
+#ifndef COMPACT_HALF_EDGE_MESH_HPP
+#define COMPACT_HALF_EDGE_MESH_HPP
+#include <vector>
+#include <mesh_data/structures/he_vertex.hpp>
+#include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/structures/compact_half_edge.hpp>
+#include <mesh_data/structures/link_override_table.hpp>
+#include <mesh_data/half_edge_mesh_base.hpp>
+#include <concepts/mesh_data.hpp>
+#include <concepts/has_adjacency_constructor.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/access_policy.hpp>
+#include <mesh_data/access_policy.hpp>
+
+/**
+ * Half edge mesh that stores its half edges as 16 byte `CompactHalfEdge` records.
+ *
+ * The `prev` link isn't part of the record: the interior half edge `3t + j` starts as the `j`-th edge of triangle `t`,
+ * so while its triangle is intact its previous edge follows from its index. Only the `prev` links that stop
+ * following that layout (exterior edges and the ones rewritten by cavity insertion, merging or Polylla) are stored,
+ * in an override table.
+ *
+ * Since `face` shares its word with the border flag, face indices must fit in 31 bits.
+ *
+ * Every access to the internal vectors goes through `Access`, the same as in `BasicHalfEdgeMesh`.
+ */
+template <AccessPolicy Access>
+class BasicCompactHalfEdgeMesh : public HalfEdgeMeshBase<BasicCompactHalfEdgeMesh<Access>, int> {
+    using Base = HalfEdgeMeshBase<BasicCompactHalfEdgeMesh<Access>, int>;
+    friend Base;
+    public:
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
+        using Base::invalidIndexValue;
+        using VertexType = HEVertex;
+        using EdgeType = CompactHalfEdge;
+    private:
+        std::vector<VertexType> vertices;
+        std::vector<EdgeType> halfEdges;
+        std::vector<FaceIndex> polygons;
+        EdgeIndex interiorEdgeCount = 0;
+        LinkOverrideTable<EdgeIndex> prevOverrides;
+
+        EdgeIndex implicitPrev(EdgeIndex edge) const {
+            return edge < interiorEdgeCount ? edge - edge % 3 + (edge + 2) % 3 : invalidIndexValue;
+        }
+        void appendHalfEdge(const HalfEdge& he);
+        void reserveHalfEdges(size_t count) {
+            halfEdges.reserve(count);
+        }
+        void resizeHalfEdges(size_t count) {
+            halfEdges.resize(count);
+        }
+        void setHalfEdge(EdgeIndex edge, const HalfEdge& he);
+        void setBorderEdge(EdgeIndex edge, bool isBorder) {
+            Access::get(halfEdges, edge).isBorder = isBorder;
+        }
+    public:
+        BasicCompactHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
+        BasicCompactHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors);
+        VertexType& getVertex(VertexIndex v) {
+            return Access::get(vertices, v);
+        }
+        const VertexType& getVertex(VertexIndex v) const {
+            return Access::get(vertices, v);
+        }
+        const EdgeType& getEdge(EdgeIndex e) const {
+            return Access::get(halfEdges, e);
+        }
+        /**
+         * Returns the polygon index (face) associated with this half edge
+         * @param e An index of an edge whose face we need
+         * @return The polygon index associated with edge `e`
+         */
+        FaceIndex getFaceOfEdge(EdgeIndex e) const {
+            return Access::get(halfEdges, e).face;
+        }
+
+        EdgeIndex getPolygon(FaceIndex polygon) const {
+            return Access::get(polygons, polygon);
+        }
+
+        size_t getEdgeVectorSize() const {
+            return halfEdges.size();
+        }
+
+        size_t getVertexVectorSize() const {
+            return vertices.size();
+        }
+
+        size_t getFaceVectorSize() const {
+            return polygons.size();
+        }
+
+        size_t getVertexMemoryUsage() const {
+            return sizeof(decltype(vertices.back())) * vertices.capacity();
+        }
+
+        size_t getEdgesMemoryUsage() const {
+            return sizeof(decltype(halfEdges.back())) * halfEdges.capacity() + prevOverrides.getMemoryUsage();
+        }
+
+        /**
+         * Updates the `next` edge of edge `edge` to `nextEdge`
+         * @param edge The edge that needs its next edge updated
+         * @param nextEdge The new next edge
+         */
+        void setNext(EdgeIndex edge, EdgeIndex nextEdge) {
+            Access::get(halfEdges, edge).next = nextEdge;
+        }
+        /**
+         * Updates the `prev` edge of edge `edge` to `previousEdge`
+         * @param edge The edge that needs its prev edge updated
+         * @param previousEdge The new previous edge
+         */
+        void setPrev(EdgeIndex edge, EdgeIndex previousEdge) {
+            prevOverrides.set(edge, previousEdge, implicitPrev(edge));
+        }
+        /**
+         * Updates the `twin` edge of edge `edge` to `newTwin`
+         * @param edge The edge that needs its twin edge updated
+         * @param newTwin The new twin edge
+         */
+        void setTwin(EdgeIndex edge, EdgeIndex newTwin) {
+            Access::get(halfEdges, edge).twin = newTwin;
+        }
+        /**
+         * Updates the `polygons` vector so the face at `polygonIndex` now points
+         * to `identifyingEdge`
+         * @param polygonIndex The face that needs its starting edge updated
+         * @param identifyingEdge The edge that will now identify this face
+         */
+        void setEdgeAsFace(FaceIndex polygonIndex, EdgeIndex identifyingEdge) {
+            Access::get(polygons, polygonIndex) = identifyingEdge;
+        }
+        /**
+         * Updates the `face` member of `edge` so now its identified by the polygon
+         * of polygonIndex
+         * @param polygonIndex The starting edge of a face
+         * @param edge The edge that now belongs to the polygon
+         */
+        void setFaceToEdge(FaceIndex polygonIndex, EdgeIndex edge) {
+            Access::get(halfEdges, edge).face = polygonIndex;
+        }
+        /**
+         * @param edge The edge whose origin we want to get
+         * @return Index to the tail vertex `v` of the edge `edge`
+         */
+        VertexIndex origin(EdgeIndex edge) const {
+            return Access::get(halfEdges, edge).origin;
+        }
+        /**
+         * @param edge The edge we want to get the next edge from
+         * @return Index to the next edge of the face incident to `edge`
+         */
+        EdgeIndex next(EdgeIndex edge) const {
+            return Access::get(halfEdges, edge).next;
+        }
+        /**
+         * @param edge The edge whose twin we want to get
+         * @return Index to twin edge of `edge`
+         */
+        EdgeIndex twin(EdgeIndex edge) const {
+            return Access::get(halfEdges, edge).twin;
+        }
+        /**
+         * @param edge The edge whose previous edge we want to get
+         * @return Index to the previous edge of the face incident to `edge`
+         */
+        EdgeIndex prev(EdgeIndex edge) const {
+            return prevOverrides.get(edge, implicitPrev(edge));
+        }
+        /**
+         * @param v Vertex whose edge we want to get
+         * @return An index to an edge whose origin is `vertex`
+         */
+        EdgeIndex edgeOfVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).incidentHalfEdge;
+        }
+        /**
+         * @param edge Edge we want to query from
+         * @return Whether `edge` is a border edge
+         */
+        bool isBorderEdge(EdgeIndex edge) const {
+            return Access::get(halfEdges, edge).isBorder;
+        }
+        /**
+         * @param vertex Vertex we want to query
+         * @return Whether this vertex `vertex` is part of the border of the polygon
+         */
+        bool isBorderVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).isBorder;
+        }
+};
+
+template <AccessPolicy Access> inline constexpr bool isMeshData<BasicCompactHalfEdgeMesh<Access>> = true;
+
+using CompactHalfEdgeMesh = BasicCompactHalfEdgeMesh<DefaultAccessPolicy>;
+static_assert(MeshData<BasicCompactHalfEdgeMesh<CheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicCompactHalfEdgeMesh<CheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicCompactHalfEdgeMesh<CheckedAccess>>);
+static_assert(MeshData<BasicCompactHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicCompactHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicCompactHalfEdgeMesh<UncheckedAccess>>);
+
+#include <mesh_data/compact_half_edge_mesh.ipp>
+
+#endif
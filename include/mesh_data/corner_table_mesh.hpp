@@ -0,0 +1,237 @@
+#ifndef CORNER_TABLE_MESH_HPP
+#define CORNER_TABLE_MESH_HPP
+#include <vector>
+#include <mesh_data/structures/link_override_table.hpp>
+#include <mesh_data/structures/he_vertex.hpp>
+#include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/half_edge_mesh_base.hpp>
+#include <concepts/mesh_data.hpp>
+#include <concepts/has_adjacency_constructor.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/access_policy.hpp>
+#include <mesh_data/access_policy.hpp>
+
+/**
+ * Half edge mesh stored as a corner table.
+ *
+ * The half edge `3t + j` is the `j`-th corner of triangle `t`, so for an input triangulation its `next`, `prev`
+ * and face follow from its index alone and only the corner to vertex (`origin`) and corner to opposite (`twin`)
+ * arrays are stored. The exterior half edges are appended after the `3 * t` interior ones.
+ *
+ * Links that stop following the implicit triangle layout (the exterior edges, and whatever gets rewritten when
+ * inserting cavities, merging polygons or building Polylla polygons) are kept in override tables.
+ *
+ * Every access to the internal vectors goes through `Access`, the same as in `BasicHalfEdgeMesh`.
+ */
+template <AccessPolicy Access>
+class BasicCornerTableMesh : public HalfEdgeMeshBase<BasicCornerTableMesh<Access>, int> {
+    using Base = HalfEdgeMeshBase<BasicCornerTableMesh<Access>, int>;
+    friend Base;
+    public:
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
+        using Base::invalidIndexValue;
+        using VertexType = HEVertex;
+        using EdgeType = HalfEdge;
+    private:
+        using OverrideTable = LinkOverrideTable<EdgeIndex>;
+
+        std::vector<VertexType> vertices;
+        std::vector<VertexIndex> cornerVertices;
+        std::vector<EdgeIndex> opposites;
+        EdgeIndex interiorEdgeCount = 0;
+        size_t triangleCount = 0;
+
+        OverrideTable nextOverrides;
+        OverrideTable prevOverrides;
+        OverrideTable faceOverrides;
+        OverrideTable polygonOverrides;
+
+        bool isInteriorEdge(EdgeIndex edge) const {
+            return edge < interiorEdgeCount;
+        }
+        EdgeIndex implicitNext(EdgeIndex edge) const {
+            return isInteriorEdge(edge) ? edge - edge % 3 + (edge + 1) % 3 : invalidIndexValue;
+        }
+        EdgeIndex implicitPrev(EdgeIndex edge) const {
+            return isInteriorEdge(edge) ? edge - edge % 3 + (edge + 2) % 3 : invalidIndexValue;
+        }
+        FaceIndex implicitFace(EdgeIndex edge) const {
+            return isInteriorEdge(edge) ? edge / 3 : invalidIndexValue;
+        }
+
+        void appendHalfEdge(const HalfEdge& he);
+        void reserveHalfEdges(size_t count) {
+            cornerVertices.reserve(count);
+            opposites.reserve(count);
+        }
+        void resizeHalfEdges(size_t count) {
+            cornerVertices.resize(count);
+            opposites.resize(count);
+        }
+        void setHalfEdge(EdgeIndex edge, const HalfEdge& he);
+        /**
+         * The border flag isn't stored, an edge is a border edge while it has no twin or if it is exterior,
+         * which is already what construction sets it to
+         */
+        void setBorderEdge(EdgeIndex, bool) {}
+    public:
+        BasicCornerTableMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
+        BasicCornerTableMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors);
+        VertexType& getVertex(VertexIndex v) {
+            return Access::get(vertices, v);
+        }
+        const VertexType& getVertex(VertexIndex v) const {
+            return Access::get(vertices, v);
+        }
+        /**
+         * Half edges aren't stored as records in this mesh, so a copy is assembled from the corner table
+         * @param e An edge index
+         * @return A `HalfEdge` with the current values of `e`
+         */
+        EdgeType getEdge(EdgeIndex e) const;
+        /**
+         * Returns the polygon index (face) associated with this half edge
+         * @param e An index of an edge whose face we need
+         * @return The polygon index associated with edge `e`
+         */
+        FaceIndex getFaceOfEdge(EdgeIndex e) const {
+            return faceOverrides.get(e, implicitFace(e));
+        }
+
+        EdgeIndex getPolygon(FaceIndex polygon) const {
+            return polygonOverrides.get(polygon, 3 * polygon);
+        }
+
+        size_t getEdgeVectorSize() const {
+            return cornerVertices.size();
+        }
+
+        size_t getVertexVectorSize() const {
+            return vertices.size();
+        }
+
+        size_t getFaceVectorSize() const {
+            return triangleCount;
+        }
+
+        size_t getVertexMemoryUsage() const {
+            return sizeof(decltype(vertices.back())) * vertices.capacity();
+        }
+
+        size_t getEdgesMemoryUsage() const {
+            return sizeof(decltype(cornerVertices.back())) * cornerVertices.capacity()
+                + sizeof(decltype(opposites.back())) * opposites.capacity()
+                + nextOverrides.getMemoryUsage()
+                + prevOverrides.getMemoryUsage()
+                + faceOverrides.getMemoryUsage()
+                + polygonOverrides.getMemoryUsage();
+        }
+
+        /**
+         * Updates the `next` edge of edge `edge` to `nextEdge`
+         * @param edge The edge that needs its next edge updated
+         * @param nextEdge The new next edge
+         */
+        void setNext(EdgeIndex edge, EdgeIndex nextEdge) {
+            nextOverrides.set(edge, nextEdge, implicitNext(edge));
+        }
+        /**
+         * Updates the `prev` edge of edge `edge` to `previousEdge`
+         * @param edge The edge that needs its prev edge updated
+         * @param previousEdge The new previous edge
+         */
+        void setPrev(EdgeIndex edge, EdgeIndex previousEdge) {
+            prevOverrides.set(edge, previousEdge, implicitPrev(edge));
+        }
+        /**
+         * Updates the `twin` edge of edge `edge` to `newTwin`
+         * @param edge The edge that needs its twin edge updated
+         * @param newTwin The new twin edge
+         */
+        void setTwin(EdgeIndex edge, EdgeIndex newTwin) {
+            Access::get(opposites, edge) = newTwin;
+        }
+        /**
+         * Updates the face at `polygonIndex` so it now points to `identifyingEdge`
+         * @param polygonIndex The face that needs its starting edge updated
+         * @param identifyingEdge The edge that will now identify this face
+         */
+        void setEdgeAsFace(FaceIndex polygonIndex, EdgeIndex identifyingEdge) {
+            polygonOverrides.set(polygonIndex, identifyingEdge, 3 * polygonIndex);
+        }
+        /**
+         * Updates the face of `edge` so now its identified by the polygon
+         * of polygonIndex
+         * @param polygonIndex The starting edge of a face
+         * @param edge The edge that now belongs to the polygon
+         */
+        void setFaceToEdge(FaceIndex polygonIndex, EdgeIndex edge) {
+            faceOverrides.set(edge, polygonIndex, implicitFace(edge));
+        }
+        /**
+         * @param edge The edge whose origin we want to get
+         * @return Index to the tail vertex `v` of the edge `edge`
+         */
+        VertexIndex origin(EdgeIndex edge) const {
+            return Access::get(cornerVertices, edge);
+        }
+        /**
+         * @param edge The edge we want to get the next edge from
+         * @return Index to the next edge of the face incident to `edge`
+         */
+        EdgeIndex next(EdgeIndex edge) const {
+            return nextOverrides.get(edge, implicitNext(edge));
+        }
+        /**
+         * @param edge The edge whose twin we want to get
+         * @return Index to twin edge of `edge`
+         */
+        EdgeIndex twin(EdgeIndex edge) const {
+            return Access::get(opposites, edge);
+        }
+        /**
+         * @param edge The edge whose previous edge we want to get
+         * @return Index to the previous edge of the face incident to `edge`
+         */
+        EdgeIndex prev(EdgeIndex edge) const {
+            return prevOverrides.get(edge, implicitPrev(edge));
+        }
+        /**
+         * @param v Vertex whose edge we want to get
+         * @return An index to an edge whose origin is `vertex`
+         */
+        EdgeIndex edgeOfVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).incidentHalfEdge;
+        }
+        /**
+         * @param edge Edge we want to query from
+         * @return Whether `edge` is a border edge
+         */
+        bool isBorderEdge(EdgeIndex edge) const {
+            return !isInteriorEdge(edge) || Access::get(opposites, edge) == invalidIndexValue;
+        }
+        /**
+         * @param vertex Vertex we want to query
+         * @return Whether this vertex `vertex` is part of the border of the polygon
+         */
+        bool isBorderVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).isBorder;
+        }
+};
+
+template <AccessPolicy Access> inline constexpr bool isMeshData<BasicCornerTableMesh<Access>> = true;
+
+using CornerTableMesh = BasicCornerTableMesh<DefaultAccessPolicy>;
+static_assert(MeshData<BasicCornerTableMesh<CheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicCornerTableMesh<CheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicCornerTableMesh<CheckedAccess>>);
+static_assert(MeshData<BasicCornerTableMesh<UncheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicCornerTableMesh<UncheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicCornerTableMesh<UncheckedAccess>>);
+
+#include <mesh_data/corner_table_mesh.ipp>
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef HALF_EDGE_CIRCULATORS_HPP
+#define HALF_EDGE_CIRCULATORS_HPP
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+/**
+ * Range over the edges of a polygon of a half edge mesh, starting at `firstEdge` and following `next` until it gets back to it.
+ *
+ * Each step yields the pair (edge, neighborFace), where `neighborFace` is the face on the other side of `edge`
+ * or `Mesh::invalidIndexValue` if `edge` is on the border of the mesh.
+ */
+template <typename Mesh>
+class PolygonCirculator {
+    public:
+        using EdgeIndex = typename Mesh::EdgeIndex;
+        using FaceIndex = typename Mesh::FaceIndex;
+        class Iterator {
+            private:
+                const Mesh* mesh = nullptr;
+                EdgeIndex firstEdge{};
+                EdgeIndex currentEdge{};
+                bool done = true;
+            public:
+                using value_type = std::pair<EdgeIndex, FaceIndex>;
+                using difference_type = std::ptrdiff_t;
+                Iterator() = default;
+                Iterator(const Mesh* mesh, EdgeIndex firstEdge) : mesh(mesh), firstEdge(firstEdge), currentEdge(firstEdge), done(false) {}
+                value_type operator*() const {
+                    EdgeIndex twinEdge = mesh->twin(currentEdge);
+                    if (mesh->isBorderEdge(twinEdge)) {
+                        return {currentEdge, Mesh::invalidIndexValue};
+                    }
+                    return {currentEdge, mesh->getFaceOfEdge(twinEdge)};
+                }
+                Iterator& operator++() {
+                    currentEdge = mesh->next(currentEdge);
+                    done = currentEdge == firstEdge;
+                    return *this;
+                }
+                void operator++(int) {
+                    ++*this;
+                }
+                bool operator==(std::default_sentinel_t) const {
+                    return done;
+                }
+        };
+        PolygonCirculator(const Mesh& mesh, EdgeIndex firstEdge) : mesh(&mesh), firstEdge(firstEdge) {}
+        Iterator begin() const {
+            return Iterator(mesh, firstEdge);
+        }
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+    private:
+        const Mesh* mesh;
+        EdgeIndex firstEdge;
+};
+
+/**
+ * Range over the half edges that share their origin with `firstEdge`, starting at `firstEdge` and rotating
+ * around the origin until it gets back to it, counterclockwise by default or clockwise if `Clockwise` is true
+ */
+template <typename Mesh, bool Clockwise = false>
+class VertexCirculator {
+    public:
+        using EdgeIndex = typename Mesh::EdgeIndex;
+        class Iterator {
+            private:
+                const Mesh* mesh = nullptr;
+                EdgeIndex firstEdge{};
+                EdgeIndex currentEdge{};
+                bool done = true;
+            public:
+                using value_type = EdgeIndex;
+                using difference_type = std::ptrdiff_t;
+                Iterator() = default;
+                Iterator(const Mesh* mesh, EdgeIndex firstEdge) : mesh(mesh), firstEdge(firstEdge), currentEdge(firstEdge), done(false) {}
+                value_type operator*() const {
+                    return currentEdge;
+                }
+                Iterator& operator++() {
+                    if constexpr (Clockwise) {
+                        currentEdge = mesh->CWEdgeToVertex(currentEdge);
+                    } else {
+                        currentEdge = mesh->CCWEdgeToVertex(currentEdge);
+                    }
+                    done = currentEdge == firstEdge;
+                    return *this;
+                }
+                void operator++(int) {
+                    ++*this;
+                }
+                bool operator==(std::default_sentinel_t) const {
+                    return done;
+                }
+        };
+        VertexCirculator(const Mesh& mesh, EdgeIndex firstEdge) : mesh(&mesh), firstEdge(firstEdge) {}
+        Iterator begin() const {
+            return Iterator(mesh, firstEdge);
+        }
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+    private:
+        const Mesh* mesh;
+        EdgeIndex firstEdge;
+};
+
+#endif
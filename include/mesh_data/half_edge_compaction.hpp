@@ -0,0 +1,143 @@
+#ifndef HALF_EDGE_COMPACTION_HPP
+#define HALF_EDGE_COMPACTION_HPP
+#include <vector>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#include <misc/parallel.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/has_records_constructor.hpp>
+#include <mesh_data/structures/half_edge_mesh_records.hpp>
+
+/**
+ * Removal of the records a generator leaves behind, the half edges inside merged polygons and the vertices no
+ * polygon reaches anymore, so later sweeps over the output only touch live records.
+ */
+namespace half_edge_compaction {
+    template <HalfEdgeMeshData Mesh>
+    struct CompactedMesh {
+        Mesh* mesh;
+        /**
+         * The output seeds of the compacted mesh, polygon `k` of `mesh` is the one identified by `outputSeeds[k]`
+         */
+        std::vector<typename Mesh::OutputIndex> outputSeeds;
+    };
+
+    /**
+     * Builds a copy of `mesh` with only the half edges of the polygons identified by `outputSeeds` and their twins, renumbering
+     * every link in parallel. Polygons are numbered after their seed and the vertices no live half edge leaves are removed,
+     * unless the mesh keeps its original vertex ids, since written files index vertices by their position.
+     */
+    template <HalfEdgeMeshData Mesh> requires HasRecordsConstructor<Mesh>
+    CompactedMesh<Mesh> compact(const Mesh& mesh, const std::vector<typename Mesh::OutputIndex>& outputSeeds) {
+        using Index = typename Mesh::EdgeIndex;
+        using VertexType = typename Mesh::VertexType;
+        using EdgeType = typename Mesh::EdgeType;
+        constexpr Index invalid = Mesh::invalidIndexValue;
+        auto markLive = [](std::uint8_t& flag) {
+            std::atomic_ref<std::uint8_t>(flag).store(1, std::memory_order_relaxed);
+        };
+
+        std::vector<typename Mesh::OutputIndex> seeds;
+        seeds.reserve(outputSeeds.size());
+        std::copy_if(outputSeeds.begin(), outputSeeds.end(), std::back_inserter(seeds), [](Index seed) { return seed != invalid; });
+
+        size_t edgeSlots = mesh.getEdgeVectorSize();
+        size_t vertexSlots = mesh.getVertexVectorSize();
+        std::vector<std::uint8_t> liveEdge(edgeSlots, 0);
+        parallel::forEach(0, seeds.size(), [&](size_t k) {
+            Index edge = seeds[k];
+            do {
+                markLive(liveEdge[edge]);
+                markLive(liveEdge[mesh.twin(edge)]);
+                edge = mesh.next(edge);
+            } while (edge != seeds[k]);
+        });
+        bool keepEveryVertex = mesh.hasOriginalVertexIds();
+        std::vector<std::uint8_t> liveVertex(vertexSlots, keepEveryVertex ? 1 : 0);
+        if (!keepEveryVertex) {
+            parallel::forEach(0, edgeSlots, [&](size_t edge) {
+                if (liveEdge[edge]) {
+                    markLive(liveVertex[mesh.origin(edge)]);
+                }
+            });
+        }
+        std::vector<Index> newEdge(edgeSlots, invalid);
+        std::vector<Index> newVertex(vertexSlots, invalid);
+        size_t nEdges = parallel::enumerateKept(liveEdge, newEdge);
+        size_t nVertices = parallel::enumerateKept(liveVertex, newVertex);
+
+        HalfEdgeMeshRecords<VertexType, EdgeType, typename Mesh::FaceIndex> records;
+        records.halfEdges.resize(nEdges);
+        records.vertices.resize(nVertices);
+        records.polygons.resize(seeds.size());
+        records.nHalfEdges = nEdges;
+        records.nVertices = nVertices;
+        records.nPolygons = seeds.size();
+        parallel::forEach(0, edgeSlots, [&](size_t edge) {
+            if (!liveEdge[edge]) {
+                return;
+            }
+            EdgeType& record = records.halfEdges[newEdge[edge]];
+            record.origin = newVertex[mesh.origin(edge)];
+            record.twin = newEdge[mesh.twin(edge)];
+            record.next = newEdge[mesh.next(edge)];
+            record.prev = newEdge[mesh.prev(edge)];
+            // Exterior half edges have no face, interior ones get the one of their seed below
+            record.face = invalid;
+            record.isBorder = mesh.isBorderEdge(edge);
+        });
+        parallel::forEach(0, seeds.size(), [&](size_t k) {
+            Index firstEdge = newEdge[seeds[k]];
+            records.polygons[k] = firstEdge;
+            Index edge = firstEdge;
+            do {
+                records.halfEdges[edge].face = k;
+                edge = records.halfEdges[edge].next;
+            } while (edge != firstEdge);
+        });
+
+        std::vector<std::uint8_t> lostIncidentEdge(nVertices, 0);
+        parallel::forEach(0, vertexSlots, [&](size_t v) {
+            if (!liveVertex[v]) {
+                return;
+            }
+            VertexType vertex = mesh.getVertex(v);
+            Index incident = mesh.edgeOfVertex(v);
+            if (incident != invalid && liveEdge[incident]) {
+                vertex.incidentHalfEdge = newEdge[incident];
+            } else {
+                vertex.incidentHalfEdge = invalid;
+                lostIncidentEdge[newVertex[v]] = 1;
+            }
+            records.vertices[newVertex[v]] = vertex;
+        });
+        // Vertices whose incident half edge was removed take the last interior half edge leaving them
+        parallel::forEach(0, nEdges, [&](size_t edge) {
+            const EdgeType& record = records.halfEdges[edge];
+            if (record.face == invalid || !lostIncidentEdge[record.origin]) {
+                return;
+            }
+            std::atomic_ref<Index> incident(records.vertices[record.origin].incidentHalfEdge);
+            Index current = incident.load(std::memory_order_relaxed);
+            while (current < static_cast<Index>(edge) && !incident.compare_exchange_weak(current, static_cast<Index>(edge), std::memory_order_relaxed)) {}
+        });
+
+        std::vector<typename Mesh::OutputIndex> compactedSeeds(seeds.size());
+        parallel::forEach(0, seeds.size(), [&](size_t k) {
+            compactedSeeds[k] = newEdge[seeds[k]];
+        });
+        Mesh* compactedMesh = new Mesh(std::move(records));
+        if (keepEveryVertex) {
+            std::vector<typename Mesh::VertexIndex> originalVertexIds(nVertices);
+            parallel::forEach(0, nVertices, [&](size_t v) {
+                originalVertexIds[v] = mesh.originalVertexId(v);
+            });
+            compactedMesh->setOriginalVertexIds(std::move(originalVertexIds));
+        }
+        return CompactedMesh<Mesh>{compactedMesh, std::move(compactedSeeds)};
+    }
+}
+
+#endif
@@ -1,69 +1,93 @@
 #ifndef HALF_EDGE_MESH_HPP
 #define HALF_EDGE_MESH_HPP
 #include <vector>
+#include <cstdint>
 #include <mesh_data/structures/he_vertex.hpp>
 #include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/structures/half_edge_mesh_records.hpp>
 #include <cmath>
-#include <unordered_map>
-#include <unordered_set>
+#include <mesh_data/half_edge_mesh_base.hpp>
+#include <mesh_data/access_policy.hpp>
+#include <mesh_data/wide_index_mesh.hpp>
 #include <mesh_generators/mesh_generator.hpp>
 #include <concepts/mesh_data.hpp>
 #include <concepts/has_adjacency_constructor.hpp>
+#include <concepts/has_records_constructor.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/access_policy.hpp>
+#include <concepts/primitive_integral.hpp>
 
-class HalfEdgeMesh {
+/**
+ * Half edge mesh that stores its half edges as a vector of `HalfEdge` records.
+ *
+ * Every access to the internal vectors goes through `Access`, so builds that need bounds checking
+ * use `CheckedAccess` and production builds can use `UncheckedAccess` instead.
+ *
+ * Vertices, edges and faces are all identified by `Index`, 32 bit indices are enough for meshes of
+ * up to roughly 350 million triangles, bigger ones need a 64 bit `Index`.
+ */
+template <AccessPolicy Access, PrimitiveIntegral Index = int>
+class BasicHalfEdgeMesh : public HalfEdgeMeshBase<BasicHalfEdgeMesh<Access, Index>, Index> {
+    using Base = HalfEdgeMeshBase<BasicHalfEdgeMesh<Access, Index>, Index>;
+    friend Base;
     public:
-        using VertexIndex = int;
-        using EdgeIndex = int;
-        using FaceIndex = EdgeIndex;
-        using OutputIndex = EdgeIndex;
-        using VertexType = HEVertex;
-        using EdgeType = HalfEdge;
-        static constexpr OutputIndex invalidIndexValue = -1;
-        struct ConnectivityBackup {
-            std::array<EdgeIndex,6> edges;
-            std::array<EdgeIndex,6> next;
-            std::array<EdgeIndex,6> prev;
-            std::array<FaceIndex,6> faces;
-            ConnectivityBackup(std::array<EdgeIndex,6> edges, std::array<EdgeIndex,6> next, std::array<EdgeIndex,6> prev, std::array<FaceIndex,6> faces) 
-            : edges(std::move(edges)), next(std::move(next)), prev(std::move(prev)), faces(std::move(faces)) {}
-        };
-        using ConnectivityBackupT = ConnectivityBackup;
+        using VertexType = BasicHEVertex<Index>;
+        using EdgeType = BasicHalfEdge<Index>;
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
     private:
         std::vector<VertexType> vertices;
         std::vector<EdgeType> halfEdges;
         std::vector<FaceIndex> polygons;
-        size_t nVertices;
-        size_t nPolygons;
-        size_t nHalfEdges;
-        void constructInteriorHalfEdgesFromFacesAndNeighs(std::vector<FaceIndex> &faces, std::vector<FaceIndex> &neighbors);
-        void constructInteriorHalfEdgesFromFaces(std::vector<FaceIndex> &faces);
-        void constructExteriorHalfEdges();
+        void appendHalfEdge(const EdgeType& he) {
+            halfEdges.push_back(he);
+        }
+        void reserveHalfEdges(size_t count) {
+            halfEdges.reserve(count);
+        }
+        void resizeHalfEdges(size_t count) {
+            halfEdges.resize(count);
+        }
+        void setHalfEdge(EdgeIndex edge, const EdgeType& he) {
+            Access::get(halfEdges, edge) = he;
+        }
+        void setBorderEdge(EdgeIndex edge, bool isBorder) {
+            Access::get(halfEdges, edge).isBorder = isBorder;
+        }
     public:
-        HalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
-        HalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors);
-         /**
-         * Retrieves the vertices of the triangle stored at `polygonIndex`.
-         * @param polygonIndex An index to the triangle whose vertices we need
-         * @param vertex0 A reference to a vertex we will set, this can be any vertex.
-         * @param vertex1 A reference to another vertex we will set, this vertex must be the next vertex on a CCW orientation to `vertex1`
-         * @param vertex2 A reference to the last vertex we will set, this vertex must be the last vertex on a CCW orientation such that `vertex0` -> `vertex1` -> `vertex2`
-         */
-        void getVerticesOfTriangle(FaceIndex polygonIndex, Vertex& v0, Vertex& v1, Vertex& v2) const;
+        BasicHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
+        BasicHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors);
         /**
-         * @param triangle A triangle index
-         * @return An array with 3 indices that point to the CCW edges of `triangle`
+         * Takes over already linked arrays, such as the ones of a binary mesh file, without building any connectivity
          */
-        std::array<EdgeIndex,3> getEdgesOfTriangle(FaceIndex triangle) const;
+        explicit BasicHalfEdgeMesh(HalfEdgeMeshRecords<VertexType, EdgeType, FaceIndex> records);
+        const std::vector<VertexType>& getVertexRecords() const {
+            return vertices;
+        }
+        const std::vector<EdgeType>& getHalfEdgeRecords() const {
+            return halfEdges;
+        }
+        const std::vector<FaceIndex>& getPolygonRecords() const {
+            return polygons;
+        }
         VertexType& getVertex(VertexIndex v) {
-            return vertices.at(v);
+            return Access::get(vertices, v);
+        }
+        const VertexType& getVertex(VertexIndex v) const {
+            return Access::get(vertices, v);
         }
         EdgeType& getEdge(EdgeIndex e) {
-            return halfEdges.at(e);
+            return Access::get(halfEdges, e);
         }
-        std::vector<HalfEdge> getEdges() const {
+        const EdgeType& getEdge(EdgeIndex e) const {
+            return Access::get(halfEdges, e);
+        }
+        std::vector<EdgeType> getEdges() const {
             return halfEdges;
         }
-        void setEdges(std::vector<HalfEdge>& edges) {
+        void setEdges(std::vector<EdgeType>& edges) {
             halfEdges = std::move(edges);
         }
         /**
@@ -72,55 +96,11 @@ class HalfEdgeMesh {
          * @return The polygon index associated with edge `e`
          */
         FaceIndex getFaceOfEdge(EdgeIndex e) const {
-            return halfEdges.at(e).face;
-        }
-        std::pair<FaceIndex,FaceIndex> getFacesAssociatedWithEdge(EdgeIndex e) const {
-            return {getFaceOfEdge(e), getFaceOfEdge(twin(e))};
+            return Access::get(halfEdges, e).face;
         }
 
         EdgeIndex getPolygon(FaceIndex polygon) const {
-            return polygons.at(polygon);
-        }
-
-        /**
-         * @param seed An edge index that identifies a distinct polygon
-         * @return Whether the polygon is [simple](https://en.wikipedia.org/wiki/Simple_polygon) or not
-         */
-        bool isPolygonSimple(OutputIndex seed) const;
-        /**
-         * @param seedIndex An edge index that identifies a distinct polygon
-         * @return The number of edges the polygon given by `seedIndex` has
-         */
-        size_t getOutputSeedEdgeCount(OutputIndex seedIndex) const;
-
-        /**
-         * @param seed1 An edge index that identifies a distinct arbitrary polygon
-         * @param seed2 An edge index that identifies a distinct arbitrary polygon different from `seed1`
-         * @return The edges shared between 2 arbitrary polygons `seed1` and `seed2` that are interior to seed1
-         */
-        std::vector<EdgeIndex> getSharedEdges(OutputIndex seed1, OutputIndex seed2) const;
-        /**
-         * Merges two polygons via the edges specified on `edgesToMergeFrom`
-         * @param seedIndexToMergeInto The 'target' polygon that will grow by absorbing the other one
-         * @param seedIndexToMergeFrom The 'source' polygon that will be erased and made part of `seedIndexToMergeInto` along with the edges it shares with the 'target'
-         * @return A vector of `ConnectivityBackup` structs with the necessary information to undo the merge per edge if necessary
-         */
-        std::vector<ConnectivityBackupT> mergeSeeds(OutputIndex seedIndexToMergeInto, std::pair<OutputIndex,std::vector<EdgeIndex>> seedIndexToMergeFrom);
-
-        /**
-         * Undoes a merge and restores connectivity according to `backupInfo`
-         * @param backupInfo original edge connectivity information to restore
-         */
-        void rollbackMerge(const std::vector<ConnectivityBackupT>& backupInfo);
-
-        size_t numberOfVertices() const {
-            return nVertices;
-        }
-        size_t numberOfEdges() const {
-            return nHalfEdges;
-        }
-        size_t numberOfPolygons() const {
-            return nPolygons;
+            return Access::get(polygons, polygon);
         }
 
         size_t getEdgeVectorSize() const {
@@ -143,22 +123,13 @@ class HalfEdgeMesh {
             return sizeof(decltype(halfEdges.back())) * halfEdges.capacity();
         }
         
-        void updateVertexCount(size_t newAmount) {
-            this->nVertices = newAmount;
-        }
-        void updateEdgeCount(size_t newAmount) {
-            this->nHalfEdges = newAmount;
-        }
-        void updatePolygonCount(size_t newAmount) {
-            this->nPolygons = newAmount;
-        }
         /**
          * Updates the `next` edge of edge `edge` to `nextEdge`
          * @param edge The edge that needs its next edge updated
          * @param nextEdge The new next edge
          */
         void setNext(EdgeIndex edge, EdgeIndex nextEdge) {
-            halfEdges.at(edge).next = nextEdge;
+            Access::get(halfEdges, edge).next = nextEdge;
         }
         /**
          * Updates the `prev` edge of edge `edge` to `previousEdge`
@@ -166,7 +137,7 @@ class HalfEdgeMesh {
          * @param previousEdge The new previous edge
          */
         void setPrev(EdgeIndex edge, EdgeIndex previousEdge) {
-            halfEdges.at(edge).prev = previousEdge;
+            Access::get(halfEdges, edge).prev = previousEdge;
         }
         /**
          * Updates the `twin` edge of edge `edge` to `newTwin`
@@ -174,7 +145,7 @@ class HalfEdgeMesh {
          * @param newTwin The new twin edge
          */
         void setTwin(EdgeIndex edge, EdgeIndex newTwin) {
-            halfEdges.at(edge).twin = newTwin;
+            Access::get(halfEdges, edge).twin = newTwin;
         }
         /**
          * Updates the `polygons` vector so the face at `polygonIndex` now points
@@ -183,7 +154,7 @@ class HalfEdgeMesh {
          * @param identifyingEdge The edge that will now identify this face
          */
         void setEdgeAsFace(FaceIndex polygonIndex, EdgeIndex identifyingEdge) {
-            polygons[polygonIndex] = identifyingEdge;
+            Access::get(polygons, polygonIndex) = identifyingEdge;
         }
         /**
          * Updates the `face` member of `edge` so now its identified by the polygon
@@ -192,9 +163,8 @@ class HalfEdgeMesh {
          * @param edge The edge that now belongs to the polygon
          */
         void setFaceToEdge(FaceIndex polygonIndex, EdgeIndex edge) {
-            halfEdges.at(edge).face = polygonIndex;
+            Access::get(halfEdges, edge).face = polygonIndex;
         }
-        std::vector<FaceIndex> getNeighbors(FaceIndex polygon) const;
         /**
          * Calculates the tail vertex of the edge `edge`
          * 
@@ -211,19 +181,12 @@ class HalfEdgeMesh {
          * @return Index to the next edge of the face incident to `edge`
          */
         EdgeIndex next(EdgeIndex edge) const;
-        /**
-         * Calculates the head vertex of the edge `edge`
-         * 
-         * @param edge The edge whose target we want to get
-         * @return Index to the head vertex `v` of the edge `edge` 
-         */
-        VertexIndex target(EdgeIndex edge) const;
         /**
          * Returns the twin edge of the edge `edge`
          * @param edge The edge whose twin we want to get
          * @return Index to twin edge of `edge`
          */
-        EdgeIndex twin(VertexIndex edge) const;
+        EdgeIndex twin(EdgeIndex edge) const;
         /**
          * Returns the previous edge of the face incident to edge `edge`
          * 
@@ -232,25 +195,7 @@ class HalfEdgeMesh {
          * @param edge The edge whose previous edge we want to get
          * @return Index to the previous edge of the face incident to `edge`
          */
-        EdgeIndex prev(VertexIndex edge) const;
-        /**
-         * Returns the next counterclockwise edge of the origin vertex `v` of edge `edge`
-         * 
-         * This is the `twin` of the `prev` edge of `edge`
-         * 
-         * @param edge The edge with an origin `v` whose next ccw edge we need
-         * @return Index to next counterclockwise edge
-         */
-        EdgeIndex CCWEdgeToVertex(EdgeIndex e) const;
-        /**
-         * Returns the next clockwise edge of the origin vertex `v` of edge `edge`
-         * 
-         * This is the `next` of the `twin` edge of `edge`
-         * 
-         * @param edge The edge with an origin `v` whose next cw edge we need
-         * @return Index to next clockwise edge
-         */
-        EdgeIndex CWEdgeToVertex(EdgeIndex edge) const;
+        EdgeIndex prev(EdgeIndex edge) const;
         /**
          * Returns the index of the edge associated with the vertex `vertex`
          * @param v Vertex whose edge we want to get
@@ -262,52 +207,39 @@ class HalfEdgeMesh {
          * @return Whether `edge` is a border edge
          */
         bool isBorderEdge(EdgeIndex edge) const;
-        /**
-         * @param triangle1 A triangle in the mesh
-         * @param triangle2 A possible neighbor of `triangle1`
-         * @return The shared edge between `triangle1` and `triangle2` as the index of the
-         * half edge in CCW for `triangle1`, or -1 if these triangles aren't neighbors
-         */
-        EdgeIndex getTriangleSharedEdge(FaceIndex triangle1, FaceIndex triangle2) const;
         /**
          * @param vertex Vertex we want to query
          * @return Whether this vertex `vertex` is part of the border of the polygon
          */
         bool isBorderVertex(VertexIndex vertex) const;
-        /**
-         * Returns the degree of vertex `vertex`
-         * 
-         * The degree of a vertex `vertex` is equivalent to how many half edges have `vertex` as its origin
-         * 
-         * @param vertex Vertex whose degree we want to calculate
-         * @returns Amount of half edges that have `v` as its origin
-         */
-        unsigned int degree(VertexIndex vertex) const;
-        /**
-         * Returns the squared length of the edge `edge`.
-         * 
-         * This saves the cost of calculating the square root which
-         * is not necessary in most cases
-         * @param edge The edge whose length is queried
-         * @returns The squared length of the edge `edge`
-         */
-        double edgeLength2(EdgeIndex edge) const;
-        /**
-         * @returns Whether the polygon is convex or not
-         */
-        bool isPolygonConvex(FaceIndex firstEdgeOfPolygon) const;
 };
 
-template<> inline constexpr bool isMeshData<HalfEdgeMesh> = true;
+template <AccessPolicy Access, PrimitiveIntegral Index> inline constexpr bool isMeshData<BasicHalfEdgeMesh<Access, Index>> = true;
+template <AccessPolicy Access, PrimitiveIntegral Index> inline constexpr bool hasConcurrentLinkUpdates<BasicHalfEdgeMesh<Access, Index>> = true;
+
+template <AccessPolicy Access, PrimitiveIntegral Index>
+struct WideIndexMesh<BasicHalfEdgeMesh<Access, Index>> {
+    using type = BasicHalfEdgeMesh<Access, std::int64_t>;
+};
+
+using HalfEdgeMesh = BasicHalfEdgeMesh<DefaultAccessPolicy>;
+using HalfEdgeMesh64 = BasicHalfEdgeMesh<DefaultAccessPolicy, std::int64_t>;
 /** 
  * These lines must be here after the class is completely defined to make sure the
  * class adheres to the concept, it gets deleted on compilation
  * 
  * This is analogous to Java's "implements"
- * It is only used here due to HalfEdgeMesh not being templated itself, otherwise, it's not applicable
  */
-static_assert(MeshData<HalfEdgeMesh>);
-static_assert(HasAdjacencyConstructor<HalfEdgeMesh>);
+static_assert(MeshData<BasicHalfEdgeMesh<CheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicHalfEdgeMesh<CheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicHalfEdgeMesh<CheckedAccess>>);
+static_assert(HasRecordsConstructor<BasicHalfEdgeMesh<CheckedAccess>>);
+static_assert(MeshData<BasicHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicHalfEdgeMesh<UncheckedAccess>>);
+static_assert(MeshData<HalfEdgeMesh64>);
+static_assert(HasAdjacencyConstructor<HalfEdgeMesh64>);
+static_assert(HalfEdgeMeshData<HalfEdgeMesh64>);
 
 #include<mesh_data/half_edge_mesh.ipp>
 
@@ -0,0 +1,287 @@
+#ifndef HALF_EDGE_MESH_BASE_HPP
+#define HALF_EDGE_MESH_BASE_HPP
+#include <vector>
+#include <array>
+#include <utility>
+#include <initializer_list>
+#include <unordered_map>
+#include <unordered_set>
+#include <iterator>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <tuple>
+#include <atomic>
+#include <numeric>
+#include <memory>
+#include <misc/parallel.hpp>
+#include <mesh_data/structures/vertex.hpp>
+#include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/half_edge_circulators.hpp>
+#include <concepts/primitive_integral.hpp>
+
+/**
+ * Common logic of every half edge based mesh.
+ *
+ * Each half edge mesh only decides how its half edges and vertices are laid out in memory, so `Derived` must provide
+ * the basic queries `origin`, `twin`, `next`, `prev`, `getFaceOfEdge`, `isBorderEdge`, `edgeOfVertex`, `getVertex` and `getPolygon`,
+ * the setters `setNext`, `setPrev`, `setTwin`, `setFaceToEdge` and `setEdgeAsFace`, and for construction
+ * `appendHalfEdge`, `setBorderEdge`, `getEdgeVectorSize`, `reserveHalfEdges`, `resizeHalfEdges` and `setHalfEdge`.
+ *
+ * Construction sizes the half edges once and fills the interior ones in parallel, so the queries, `setTwin`, `setHalfEdge`
+ * and `setEdgeAsFace` (with the links of the triangle layout, where half edge `3i + j` belongs to triangle `i`) must be safe
+ * to call concurrently on different edges. `setHalfEdge` may ignore the border flag, construction sets it afterwards
+ * through `setBorderEdge`, which is only called from one thread at a time like every other setter.
+ *
+ * Every other topological query or update is written here in terms of those.
+ */
+template <typename Derived, PrimitiveIntegral Index>
+class HalfEdgeMeshBase {
+    public:
+        using VertexIndex = Index;
+        using EdgeIndex = Index;
+        using FaceIndex = EdgeIndex;
+        using OutputIndex = EdgeIndex;
+        static constexpr OutputIndex invalidIndexValue = -1;
+        struct ConnectivityBackup {
+            std::array<EdgeIndex,6> edges;
+            std::array<EdgeIndex,6> next;
+            std::array<EdgeIndex,6> prev;
+            std::array<FaceIndex,6> faces;
+            ConnectivityBackup(std::array<EdgeIndex,6> edges, std::array<EdgeIndex,6> next, std::array<EdgeIndex,6> prev, std::array<FaceIndex,6> faces)
+            : edges(std::move(edges)), next(std::move(next)), prev(std::move(prev)), faces(std::move(faces)) {}
+        };
+        using ConnectivityBackupT = ConnectivityBackup;
+    protected:
+        /**
+         * Record passed to `appendHalfEdge` and `setHalfEdge` while constructing the mesh
+         */
+        using HalfEdgeT = BasicHalfEdge<Index>;
+        size_t nVertices = 0;
+        size_t nPolygons = 0;
+        size_t nHalfEdges = 0;
+        /**
+         * Original index of each vertex when the mesh was renumbered after reading it, shared between copies
+         */
+        std::shared_ptr<const std::vector<VertexIndex>> originalVertexIds;
+
+        Derived& derived() {
+            return static_cast<Derived&>(*this);
+        }
+        const Derived& derived() const {
+            return static_cast<const Derived&>(*this);
+        }
+        /**
+         * Sizes the half edges for the triangles in `faces` and fills them in parallel, without their twins
+         * @return The amount of interior half edges
+         */
+        size_t constructInteriorHalfEdgeRecords(std::vector<FaceIndex> &faces);
+        /**
+         * Points every vertex to the last interior half edge (the one with the highest index) that leaves it
+         */
+        void assignIncidentHalfEdges(std::vector<FaceIndex> &faces);
+        /**
+         * Creates the interior half edges of the triangles in `faces`, using `neighbors` to find their twins
+         */
+        void constructInteriorHalfEdgesFromFacesAndNeighs(std::vector<FaceIndex> &faces, std::vector<FaceIndex> &neighbors);
+        /**
+         * Creates the interior half edges of the triangles in `faces`, twins are matched by their vertices
+         */
+        void constructInteriorHalfEdgesFromFaces(std::vector<FaceIndex> &faces);
+        /**
+         * Finds the twins of the interior half edges of the triangles in `faces` by radix sorting their (min vertex, max vertex) keys
+         * and pairing each key with its reversed copy in a single sweep, the half edges left without a twin are labeled as border
+         */
+        void matchTwinsBySortedKeys(std::vector<FaceIndex> &faces);
+        /**
+         * Creates the exterior half edges, the twins of interior edges labeled as border, and links them
+         * together around the boundary
+         */
+        void constructExteriorHalfEdges();
+    public:
+        /**
+         * Records the permutation applied to the vertices before constructing the mesh, so writers can emit the original ids
+         * @param ids The original index of each vertex, indexed by its current index
+         */
+        void setOriginalVertexIds(std::vector<VertexIndex> ids) {
+            originalVertexIds = std::make_shared<const std::vector<VertexIndex>>(std::move(ids));
+        }
+        /**
+         * @return Whether the vertices were renumbered when reading the mesh
+         */
+        bool hasOriginalVertexIds() const {
+            return originalVertexIds != nullptr;
+        }
+        /**
+         * @return The index `v` had in the input files, `v` itself if the vertices weren't renumbered
+         */
+        VertexIndex originalVertexId(VertexIndex v) const {
+            return originalVertexIds ? (*originalVertexIds)[v] : v;
+        }
+         /**
+         * Retrieves the vertices of the triangle stored at `polygonIndex`.
+         * @param polygonIndex An index to the triangle whose vertices we need
+         * @param vertex0 A reference to a vertex we will set, this can be any vertex.
+         * @param vertex1 A reference to another vertex we will set, this vertex must be the next vertex on a CCW orientation to `vertex1`
+         * @param vertex2 A reference to the last vertex we will set, this vertex must be the last vertex on a CCW orientation such that `vertex0` -> `vertex1` -> `vertex2`
+         */
+        void getVerticesOfTriangle(FaceIndex polygonIndex, Vertex& v0, Vertex& v1, Vertex& v2) const;
+        /**
+         * @param triangle A triangle index
+         * @return An array with 3 indices that point to the CCW edges of `triangle`
+         */
+        std::array<EdgeIndex,3> getEdgesOfTriangle(FaceIndex triangle) const;
+
+        std::pair<FaceIndex,FaceIndex> getFacesAssociatedWithEdge(EdgeIndex e) const {
+            return {derived().getFaceOfEdge(e), derived().getFaceOfEdge(derived().twin(e))};
+        }
+
+        /**
+         * @param seed An edge index that identifies a distinct polygon
+         * @return Whether the polygon is [simple](https://en.wikipedia.org/wiki/Simple_polygon) or not
+         */
+        bool isPolygonSimple(OutputIndex seed) const;
+        /**
+         * @param seedIndex An edge index that identifies a distinct polygon
+         * @return The number of edges the polygon given by `seedIndex` has
+         */
+        size_t getOutputSeedEdgeCount(OutputIndex seedIndex) const;
+
+        /**
+         * @param seed1 An edge index that identifies a distinct arbitrary polygon
+         * @param seed2 An edge index that identifies a distinct arbitrary polygon different from `seed1`
+         * @return The edges shared between 2 arbitrary polygons `seed1` and `seed2` that are interior to seed1
+         */
+        std::vector<EdgeIndex> getSharedEdges(OutputIndex seed1, OutputIndex seed2) const;
+        /**
+         * Merges two polygons via the edges specified on `edgesToMergeFrom`
+         * @param seedIndexToMergeInto The 'target' polygon that will grow by absorbing the other one
+         * @param seedIndexToMergeFrom The 'source' polygon that will be erased and made part of `seedIndexToMergeInto` along with the edges it shares with the 'target'
+         * @return A vector of `ConnectivityBackup` structs with the necessary information to undo the merge per edge if necessary
+         */
+        std::vector<ConnectivityBackupT> mergeSeeds(OutputIndex seedIndexToMergeInto, std::pair<OutputIndex,std::vector<EdgeIndex>> seedIndexToMergeFrom);
+
+        /**
+         * Undoes a merge and restores connectivity according to `backupInfo`
+         * @param backupInfo original edge connectivity information to restore
+         */
+        void rollbackMerge(const std::vector<ConnectivityBackupT>& backupInfo);
+
+        size_t numberOfVertices() const {
+            return nVertices;
+        }
+        size_t numberOfEdges() const {
+            return nHalfEdges;
+        }
+        size_t numberOfPolygons() const {
+            return nPolygons;
+        }
+        void updateVertexCount(size_t newAmount) {
+            this->nVertices = newAmount;
+        }
+        void updateEdgeCount(size_t newAmount) {
+            this->nHalfEdges = newAmount;
+        }
+        void updatePolygonCount(size_t newAmount) {
+            this->nPolygons = newAmount;
+        }
+
+        std::vector<FaceIndex> getNeighbors(FaceIndex polygon) const;
+        /**
+         * Circulates the edges of the polygon `polygon` without allocating
+         * @param polygon A face index
+         * @return A range of (edge, neighborFace) pairs for each CCW edge of `polygon`, `neighborFace` is `invalidIndexValue`
+         * when the edge is on the border of the mesh
+         */
+        PolygonCirculator<Derived> facesAround(FaceIndex polygon) const {
+            return facesAroundSeed(derived().getPolygon(polygon));
+        }
+        /**
+         * Same as `facesAround` but for the polygon identified by the edge `seed`, starting at `seed`
+         * @param seed An edge index that identifies a distinct polygon
+         * @return A range of (edge, neighborFace) pairs for each edge of the polygon
+         */
+        PolygonCirculator<Derived> facesAroundSeed(OutputIndex seed) const {
+            return PolygonCirculator<Derived>(derived(), seed);
+        }
+        /**
+         * Circulates the half edges whose origin is `vertex` in CCW order without allocating
+         * @param vertex A vertex index
+         * @return A range of the edge indices that have `vertex` as their origin, starting at `edgeOfVertex(vertex)`
+         */
+        VertexCirculator<Derived> edgesAroundVertex(VertexIndex vertex) const {
+            return VertexCirculator<Derived>(derived(), derived().edgeOfVertex(vertex));
+        }
+        /**
+         * Circulates the half edges that share their origin with `edge` in CW order, starting at `edge`
+         * @param edge An edge index
+         * @return A range of the edge indices that have the origin of `edge` as their origin
+         */
+        VertexCirculator<Derived, true> edgesAroundOriginCW(EdgeIndex edge) const {
+            return VertexCirculator<Derived, true>(derived(), edge);
+        }
+        /**
+         * Calculates the head vertex of the edge `edge`
+         *
+         * @param edge The edge whose target we want to get
+         * @return Index to the head vertex `v` of the edge `edge`
+         */
+        VertexIndex target(EdgeIndex edge) const {
+            return derived().origin(derived().twin(edge));
+        }
+        /**
+         * Returns the next counterclockwise edge of the origin vertex `v` of edge `edge`
+         *
+         * This is the `twin` of the `prev` edge of `edge`
+         *
+         * @param edge The edge with an origin `v` whose next ccw edge we need
+         * @return Index to next counterclockwise edge
+         */
+        EdgeIndex CCWEdgeToVertex(EdgeIndex edge) const {
+            return derived().twin(derived().prev(edge));
+        }
+        /**
+         * Returns the next clockwise edge of the origin vertex `v` of edge `edge`
+         *
+         * This is the `next` of the `twin` edge of `edge`
+         *
+         * @param edge The edge with an origin `v` whose next cw edge we need
+         * @return Index to next clockwise edge
+         */
+        EdgeIndex CWEdgeToVertex(EdgeIndex edge) const {
+            return derived().next(derived().twin(edge));
+        }
+        /**
+         * @param triangle1 A triangle in the mesh
+         * @param triangle2 A possible neighbor of `triangle1`
+         * @return The shared edge between `triangle1` and `triangle2` as the index of the
+         * half edge in CCW for `triangle1`, or -1 if these triangles aren't neighbors
+         */
+        EdgeIndex getTriangleSharedEdge(FaceIndex triangle1, FaceIndex triangle2) const;
+        /**
+         * Returns the degree of vertex `vertex`
+         *
+         * The degree of a vertex `vertex` is equivalent to how many half edges have `vertex` as its origin
+         *
+         * @param vertex Vertex whose degree we want to calculate
+         * @returns Amount of half edges that have `v` as its origin
+         */
+        unsigned int degree(VertexIndex vertex) const;
+        /**
+         * Returns the squared length of the edge `edge`.
+         *
+         * This saves the cost of calculating the square root which
+         * is not necessary in most cases
+         * @param edge The edge whose length is queried
+         * @returns The squared length of the edge `edge`
+         */
+        double edgeLength2(EdgeIndex edge) const;
+        /**
+         * @returns Whether the polygon is convex or not
+         */
+        bool isPolygonConvex(FaceIndex firstEdgeOfPolygon) const;
+};
+
+#include <mesh_data/half_edge_mesh_base.ipp>
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef OVERLAY_HALF_EDGE_MESH_HPP
+#define OVERLAY_HALF_EDGE_MESH_HPP
+#include <vector>
+#include <memory>
+#include <mesh_data/half_edge_mesh.hpp>
+#include <mesh_data/half_edge_mesh_base.hpp>
+#include <mesh_data/wide_index_mesh.hpp>
+#include <mesh_data/structures/link_override_table.hpp>
+#include <mesh_data/structures/half_edge_mesh_records.hpp>
+#include <concepts/mesh_data.hpp>
+#include <concepts/has_adjacency_constructor.hpp>
+#include <concepts/has_records_constructor.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+
+/**
+ * Half edge mesh that references an immutable `BaseMesh` and only stores the connectivity that has been changed on top of it.
+ *
+ * The base mesh is shared between copies, so copying an overlay (as the generators do to get their output mesh from the input)
+ * only copies its changes instead of every vertex and half edge. Every `next`, `prev`, face and identifying edge of a face
+ * that gets updated is kept in an override table and read before falling back to the base mesh, while vertices, origins,
+ * twins and border flags always come from the base mesh since they aren't modified after construction.
+ *
+ * The override tables are paged arrays instead of hash maps, so a query reads the page of its key only if a link near it
+ * has been changed, and otherwise goes straight to the base mesh. A copy only allocates the pages its source had.
+ */
+template <HalfEdgeMeshData BaseMesh>
+class BasicOverlayHalfEdgeMesh : public HalfEdgeMeshBase<BasicOverlayHalfEdgeMesh<BaseMesh>, typename BaseMesh::EdgeIndex> {
+    using Base = HalfEdgeMeshBase<BasicOverlayHalfEdgeMesh<BaseMesh>, typename BaseMesh::EdgeIndex>;
+    friend Base;
+    public:
+        using VertexType = typename BaseMesh::VertexType;
+        using EdgeType = typename BaseMesh::EdgeType;
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
+    private:
+        std::shared_ptr<const BaseMesh> baseMesh;
+        /**
+         * Only the overlay created from the input vectors accounts for the memory of the base mesh,
+         * copies only account for their own changes
+         */
+        bool ownsBaseMesh = true;
+        LinkOverrideTable<EdgeIndex> nextOverrides;
+        LinkOverrideTable<EdgeIndex> prevOverrides;
+        LinkOverrideTable<EdgeIndex> faceOverrides;
+        LinkOverrideTable<EdgeIndex> polygonOverrides;
+
+        void copyCountsFromBaseMesh();
+    public:
+        BasicOverlayHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
+        BasicOverlayHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors)
+            requires HasAdjacencyConstructor<BaseMesh>;
+        explicit BasicOverlayHalfEdgeMesh(HalfEdgeMeshRecords<VertexType, EdgeType, FaceIndex> records)
+            requires HasRecordsConstructor<BaseMesh>;
+        /**
+         * Shares the base mesh of `other` and copies only its changes
+         */
+        BasicOverlayHalfEdgeMesh(const BasicOverlayHalfEdgeMesh& other);
+        BasicOverlayHalfEdgeMesh(BasicOverlayHalfEdgeMesh&& other) = default;
+        BasicOverlayHalfEdgeMesh& operator=(const BasicOverlayHalfEdgeMesh& other);
+        BasicOverlayHalfEdgeMesh& operator=(BasicOverlayHalfEdgeMesh&& other) = default;
+
+        /**
+         * Vertices belong to the base mesh and can't be modified through an overlay
+         */
+        const VertexType& getVertex(VertexIndex v) const {
+            return baseMesh->getVertex(v);
+        }
+        /**
+         * @param e An edge index
+         * @return A copy of the edge `e` of the base mesh with the changes of this overlay applied
+         */
+        EdgeType getEdge(EdgeIndex e) const;
+        /**
+         * Returns the polygon index (face) associated with this half edge
+         * @param e An index of an edge whose face we need
+         * @return The polygon index associated with edge `e`
+         */
+        FaceIndex getFaceOfEdge(EdgeIndex e) const {
+            return faceOverrides.get(e, baseMesh->getFaceOfEdge(e));
+        }
+
+        EdgeIndex getPolygon(FaceIndex polygon) const {
+            return polygonOverrides.get(polygon, baseMesh->getPolygon(polygon));
+        }
+
+        size_t getEdgeVectorSize() const {
+            return baseMesh->getEdgeVectorSize();
+        }
+
+        size_t getVertexVectorSize() const {
+            return baseMesh->getVertexVectorSize();
+        }
+
+        size_t getFaceVectorSize() const {
+            return baseMesh->getFaceVectorSize();
+        }
+
+        size_t getVertexMemoryUsage() const {
+            return ownsBaseMesh ? baseMesh->getVertexMemoryUsage() : 0;
+        }
+
+        size_t getEdgesMemoryUsage() const {
+            return (ownsBaseMesh ? baseMesh->getEdgesMemoryUsage() : 0)
+                + nextOverrides.getMemoryUsage()
+                + prevOverrides.getMemoryUsage()
+                + faceOverrides.getMemoryUsage()
+                + polygonOverrides.getMemoryUsage();
+        }
+
+        /**
+         * Updates the `next` edge of edge `edge` to `nextEdge`
+         * @param edge The edge that needs its next edge updated
+         * @param nextEdge The new next edge
+         */
+        void setNext(EdgeIndex edge, EdgeIndex nextEdge) {
+            nextOverrides.set(edge, nextEdge, baseMesh->next(edge));
+        }
+        /**
+         * Updates the `prev` edge of edge `edge` to `previousEdge`
+         * @param edge The edge that needs its prev edge updated
+         * @param previousEdge The new previous edge
+         */
+        void setPrev(EdgeIndex edge, EdgeIndex previousEdge) {
+            prevOverrides.set(edge, previousEdge, baseMesh->prev(edge));
+        }
+        /**
+         * Updates the face at `polygonIndex` so it now points to `identifyingEdge`
+         * @param polygonIndex The face that needs its starting edge updated
+         * @param identifyingEdge The edge that will now identify this face
+         */
+        void setEdgeAsFace(FaceIndex polygonIndex, EdgeIndex identifyingEdge) {
+            polygonOverrides.set(polygonIndex, identifyingEdge, baseMesh->getPolygon(polygonIndex));
+        }
+        /**
+         * Updates the face of `edge` so now its identified by the polygon
+         * of polygonIndex
+         * @param polygonIndex The starting edge of a face
+         * @param edge The edge that now belongs to the polygon
+         */
+        void setFaceToEdge(FaceIndex polygonIndex, EdgeIndex edge) {
+            faceOverrides.set(edge, polygonIndex, baseMesh->getFaceOfEdge(edge));
+        }
+        /**
+         * @param edge The edge whose origin we want to get
+         * @return Index to the tail vertex `v` of the edge `edge`
+         */
+        VertexIndex origin(EdgeIndex edge) const {
+            return baseMesh->origin(edge);
+        }
+        /**
+         * @param edge The edge we want to get the next edge from
+         * @return Index to the next edge of the face incident to `edge`
+         */
+        EdgeIndex next(EdgeIndex edge) const {
+            return nextOverrides.get(edge, baseMesh->next(edge));
+        }
+        /**
+         * @param edge The edge whose twin we want to get
+         * @return Index to twin edge of `edge`
+         */
+        EdgeIndex twin(EdgeIndex edge) const {
+            return baseMesh->twin(edge);
+        }
+        /**
+         * @param edge The edge whose previous edge we want to get
+         * @return Index to the previous edge of the face incident to `edge`
+         */
+        EdgeIndex prev(EdgeIndex edge) const {
+            return prevOverrides.get(edge, baseMesh->prev(edge));
+        }
+        /**
+         * @param v Vertex whose edge we want to get
+         * @return An index to an edge whose origin is `vertex`
+         */
+        EdgeIndex edgeOfVertex(VertexIndex vertex) const {
+            return baseMesh->edgeOfVertex(vertex);
+        }
+        /**
+         * @param edge Edge we want to query from
+         * @return Whether `edge` is a border edge
+         */
+        bool isBorderEdge(EdgeIndex edge) const {
+            return baseMesh->isBorderEdge(edge);
+        }
+        /**
+         * @param vertex Vertex we want to query
+         * @return Whether this vertex `vertex` is part of the border of the polygon
+         */
+        bool isBorderVertex(VertexIndex vertex) const {
+            return baseMesh->isBorderVertex(vertex);
+        }
+};
+
+template <HalfEdgeMeshData BaseMesh> inline constexpr bool isMeshData<BasicOverlayHalfEdgeMesh<BaseMesh>> = true;
+
+template <HalfEdgeMeshData BaseMesh>
+struct WideIndexMesh<BasicOverlayHalfEdgeMesh<BaseMesh>> {
+    using type = BasicOverlayHalfEdgeMesh<WideIndexMeshT<BaseMesh>>;
+};
+
+using OverlayHalfEdgeMesh = BasicOverlayHalfEdgeMesh<HalfEdgeMesh>;
+static_assert(MeshData<OverlayHalfEdgeMesh>);
+static_assert(HasAdjacencyConstructor<OverlayHalfEdgeMesh>);
+static_assert(HasRecordsConstructor<OverlayHalfEdgeMesh>);
+static_assert(HalfEdgeMeshData<OverlayHalfEdgeMesh>);
+
+#include <mesh_data/overlay_half_edge_mesh.ipp>
+
+#endif
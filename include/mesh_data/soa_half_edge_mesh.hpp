@@ -0,0 +1,220 @@
+#ifndef SOA_HALF_EDGE_MESH_HPP
+#define SOA_HALF_EDGE_MESH_HPP
+#include <vector>
+#include <cstdint>
+#include <mesh_data/structures/he_vertex.hpp>
+#include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/half_edge_mesh_base.hpp>
+#include <concepts/mesh_data.hpp>
+#include <concepts/has_adjacency_constructor.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/access_policy.hpp>
+#include <mesh_data/access_policy.hpp>
+
+/**
+ * Half edge mesh that stores every field of its half edges in a separate array (structure of arrays) instead of
+ * a single vector of `HalfEdge` records.
+ *
+ * Traversals usually only need one or two fields per step (`next` and `twin` for walks and rotations around a vertex),
+ * so keeping them apart means each cache line fetched only carries the field that is being followed.
+ * The border flag is kept as a bitset.
+ *
+ * Every access to the internal vectors goes through `Access`, the same as in `BasicHalfEdgeMesh`.
+ */
+template <AccessPolicy Access>
+class BasicSoAHalfEdgeMesh : public HalfEdgeMeshBase<BasicSoAHalfEdgeMesh<Access>, int> {
+    using Base = HalfEdgeMeshBase<BasicSoAHalfEdgeMesh<Access>, int>;
+    friend Base;
+    public:
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
+        using Base::invalidIndexValue;
+        using VertexType = HEVertex;
+        using EdgeType = HalfEdge;
+    private:
+        using BitWord = uint64_t;
+        static constexpr unsigned int bitsPerWord = 64;
+
+        std::vector<VertexType> vertices;
+        std::vector<VertexIndex> origins;
+        std::vector<EdgeIndex> twins;
+        std::vector<EdgeIndex> nexts;
+        std::vector<EdgeIndex> prevs;
+        std::vector<FaceIndex> faces;
+        std::vector<BitWord> borderBits;
+        std::vector<FaceIndex> polygons;
+
+        void appendHalfEdge(const HalfEdge& he);
+        void setBorderEdge(EdgeIndex edge, bool isBorder);
+        void reserveHalfEdges(size_t count);
+        void resizeHalfEdges(size_t count);
+        /**
+         * Leaves the border bit of `edge` as is, since neighboring edges share its word
+         */
+        void setHalfEdge(EdgeIndex edge, const HalfEdge& he);
+        /**
+         * Releases the extra capacity left after adding the exterior half edges
+         */
+        void shrinkHalfEdges();
+    public:
+        BasicSoAHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces);
+        BasicSoAHalfEdgeMesh(std::vector<VertexType> vertices, std::vector<EdgeType> edges, std::vector<FaceIndex> faces, std::vector<FaceIndex> neighbors);
+        VertexType& getVertex(VertexIndex v) {
+            return Access::get(vertices, v);
+        }
+        const VertexType& getVertex(VertexIndex v) const {
+            return Access::get(vertices, v);
+        }
+        /**
+         * Half edges aren't stored as records in this mesh, so a copy is assembled from each array
+         * @param e An edge index
+         * @return A `HalfEdge` with the current values of `e`
+         */
+        EdgeType getEdge(EdgeIndex e) const;
+        /**
+         * Returns the polygon index (face) associated with this half edge
+         * @param e An index of an edge whose face we need
+         * @return The polygon index associated with edge `e`
+         */
+        FaceIndex getFaceOfEdge(EdgeIndex e) const {
+            return Access::get(faces, e);
+        }
+
+        EdgeIndex getPolygon(FaceIndex polygon) const {
+            return Access::get(polygons, polygon);
+        }
+
+        size_t getEdgeVectorSize() const {
+            return origins.size();
+        }
+
+        size_t getVertexVectorSize() const {
+            return vertices.size();
+        }
+
+        size_t getFaceVectorSize() const {
+            return polygons.size();
+        }
+
+        size_t getVertexMemoryUsage() const {
+            return sizeof(decltype(vertices.back())) * vertices.capacity();
+        }
+
+        size_t getEdgesMemoryUsage() const {
+            return sizeof(decltype(origins.back())) * origins.capacity()
+                + sizeof(decltype(twins.back())) * twins.capacity()
+                + sizeof(decltype(nexts.back())) * nexts.capacity()
+                + sizeof(decltype(prevs.back())) * prevs.capacity()
+                + sizeof(decltype(faces.back())) * faces.capacity()
+                + sizeof(decltype(borderBits.back())) * borderBits.capacity();
+        }
+
+        /**
+         * Updates the `next` edge of edge `edge` to `nextEdge`
+         * @param edge The edge that needs its next edge updated
+         * @param nextEdge The new next edge
+         */
+        void setNext(EdgeIndex edge, EdgeIndex nextEdge) {
+            Access::get(nexts, edge) = nextEdge;
+        }
+        /**
+         * Updates the `prev` edge of edge `edge` to `previousEdge`
+         * @param edge The edge that needs its prev edge updated
+         * @param previousEdge The new previous edge
+         */
+        void setPrev(EdgeIndex edge, EdgeIndex previousEdge) {
+            Access::get(prevs, edge) = previousEdge;
+        }
+        /**
+         * Updates the `twin` edge of edge `edge` to `newTwin`
+         * @param edge The edge that needs its twin edge updated
+         * @param newTwin The new twin edge
+         */
+        void setTwin(EdgeIndex edge, EdgeIndex newTwin) {
+            Access::get(twins, edge) = newTwin;
+        }
+        /**
+         * Updates the `polygons` vector so the face at `polygonIndex` now points
+         * to `identifyingEdge`
+         * @param polygonIndex The face that needs its starting edge updated
+         * @param identifyingEdge The edge that will now identify this face
+         */
+        void setEdgeAsFace(FaceIndex polygonIndex, EdgeIndex identifyingEdge) {
+            Access::get(polygons, polygonIndex) = identifyingEdge;
+        }
+        /**
+         * Updates the face of `edge` so now its identified by the polygon
+         * of polygonIndex
+         * @param polygonIndex The starting edge of a face
+         * @param edge The edge that now belongs to the polygon
+         */
+        void setFaceToEdge(FaceIndex polygonIndex, EdgeIndex edge) {
+            Access::get(faces, edge) = polygonIndex;
+        }
+        /**
+         * @param edge The edge whose origin we want to get
+         * @return Index to the tail vertex `v` of the edge `edge`
+         */
+        VertexIndex origin(EdgeIndex edge) const {
+            return Access::get(origins, edge);
+        }
+        /**
+         * @param edge The edge we want to get the next edge from
+         * @return Index to the next edge of the face incident to `edge`
+         */
+        EdgeIndex next(EdgeIndex edge) const {
+            return Access::get(nexts, edge);
+        }
+        /**
+         * @param edge The edge whose twin we want to get
+         * @return Index to twin edge of `edge`
+         */
+        EdgeIndex twin(EdgeIndex edge) const {
+            return Access::get(twins, edge);
+        }
+        /**
+         * @param edge The edge whose previous edge we want to get
+         * @return Index to the previous edge of the face incident to `edge`
+         */
+        EdgeIndex prev(EdgeIndex edge) const {
+            return Access::get(prevs, edge);
+        }
+        /**
+         * @param v Vertex whose edge we want to get
+         * @return An index to an edge whose origin is `vertex`
+         */
+        EdgeIndex edgeOfVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).incidentHalfEdge;
+        }
+        /**
+         * @param edge Edge we want to query from
+         * @return Whether `edge` is a border edge
+         */
+        bool isBorderEdge(EdgeIndex edge) const {
+            return (Access::get(borderBits, edge / bitsPerWord) >> (edge % bitsPerWord)) & 1u;
+        }
+        /**
+         * @param vertex Vertex we want to query
+         * @return Whether this vertex `vertex` is part of the border of the polygon
+         */
+        bool isBorderVertex(VertexIndex vertex) const {
+            return Access::get(vertices, vertex).isBorder;
+        }
+};
+
+template <AccessPolicy Access> inline constexpr bool isMeshData<BasicSoAHalfEdgeMesh<Access>> = true;
+template <AccessPolicy Access> inline constexpr bool hasConcurrentLinkUpdates<BasicSoAHalfEdgeMesh<Access>> = true;
+
+using SoAHalfEdgeMesh = BasicSoAHalfEdgeMesh<DefaultAccessPolicy>;
+static_assert(MeshData<BasicSoAHalfEdgeMesh<CheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicSoAHalfEdgeMesh<CheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicSoAHalfEdgeMesh<CheckedAccess>>);
+static_assert(MeshData<BasicSoAHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HasAdjacencyConstructor<BasicSoAHalfEdgeMesh<UncheckedAccess>>);
+static_assert(HalfEdgeMeshData<BasicSoAHalfEdgeMesh<UncheckedAccess>>);
+
+#include <mesh_data/soa_half_edge_mesh.ipp>
+
+#endif
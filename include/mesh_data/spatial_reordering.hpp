@@ -0,0 +1,147 @@
+#ifndef SPATIAL_REORDERING_HPP
+#define SPATIAL_REORDERING_HPP
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <misc/parallel.hpp>
+#include <concepts/primitive_integral.hpp>
+
+/**
+ * Renumbering of a triangulation along a Hilbert curve, so vertices and triangles that are close in the plane
+ * also end up close in memory. Half edges follow their triangles since half edge `3t + j` belongs to triangle `t`.
+ */
+namespace spatial_reordering {
+    /**
+     * Cells per axis of the grid points are snapped to before computing their position along the curve
+     */
+    inline constexpr std::uint32_t gridSize = 1u << 16;
+
+    /**
+     * @return The position of the cell (`x`, `y`) along the Hilbert curve that covers the `gridSize` x `gridSize` grid
+     */
+    inline std::uint32_t hilbertIndex(std::uint32_t x, std::uint32_t y) {
+        std::uint32_t d = 0;
+        for (std::uint32_t s = gridSize / 2; s > 0; s /= 2) {
+            std::uint32_t rx = (x & s) > 0;
+            std::uint32_t ry = (y & s) > 0;
+            d += s * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = gridSize - 1 - x;
+                    y = gridSize - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return d;
+    }
+
+    /**
+     * Maps points of a bounding box to their cell of the curve's grid
+     */
+    class HilbertKey {
+        private:
+            double xmin = 0.0;
+            double ymin = 0.0;
+            double scale = 0.0;
+        public:
+            template <typename VertexType>
+            explicit HilbertKey(const std::vector<VertexType>& vertices) {
+                if (vertices.empty()) {
+                    return;
+                }
+                double xmax = vertices[0].x;
+                double ymax = vertices[0].y;
+                xmin = xmax;
+                ymin = ymax;
+                for (const VertexType& vertex : vertices) {
+                    xmin = std::min<double>(xmin, vertex.x);
+                    xmax = std::max<double>(xmax, vertex.x);
+                    ymin = std::min<double>(ymin, vertex.y);
+                    ymax = std::max<double>(ymax, vertex.y);
+                }
+                double extent = std::max(xmax - xmin, ymax - ymin);
+                scale = extent > 0.0 ? (gridSize - 1) / extent : 0.0;
+            }
+            std::uint32_t operator()(double x, double y) const {
+                return hilbertIndex(static_cast<std::uint32_t>((x - xmin) * scale), static_cast<std::uint32_t>((y - ymin) * scale));
+            }
+    };
+
+    /**
+     * @return The permutation (new index to old index) that sorts `size` elements by `key(i)`, ties keep their old order
+     */
+    template <PrimitiveIntegral Index, typename KeyFunction>
+    std::vector<Index> sortedOrder(size_t size, KeyFunction key) {
+        std::vector<std::pair<std::uint32_t, Index>> keyed(size);
+        parallel::forEach(0, size, [&](size_t i) {
+            keyed[i] = {key(i), static_cast<Index>(i)};
+        });
+        parallel::radixSort(keyed, [](const std::pair<std::uint32_t, Index>& entry) {
+            return entry.first;
+        }, 32);
+        std::vector<Index> order(size);
+        parallel::forEach(0, size, [&](size_t i) {
+            order[i] = keyed[i].second;
+        });
+        return order;
+    }
+
+    /**
+     * Renumbers the vertices by their position along the Hilbert curve and the triangles by the position of their centroid,
+     * rewriting `faces` and `neighbors` (if not empty) to the new numbering. The vertices of each triangle keep their order.
+     * @return The original index of each vertex, indexed by its new index
+     */
+    template <typename VertexType, PrimitiveIntegral Index>
+    std::vector<Index> reorderAlongHilbertCurve(std::vector<VertexType>& vertices, std::vector<Index>& faces, std::vector<Index>& neighbors) {
+        HilbertKey hilbertKey(vertices);
+        size_t nVertices = vertices.size();
+        size_t nTriangles = faces.size() / 3;
+
+        std::vector<Index> originalVertexIds = sortedOrder<Index>(nVertices, [&](size_t v) {
+            return hilbertKey(vertices[v].x, vertices[v].y);
+        });
+        std::vector<Index> newVertexIds(nVertices);
+        std::vector<VertexType> reorderedVertices(nVertices);
+        parallel::forEach(0, nVertices, [&](size_t v) {
+            newVertexIds[originalVertexIds[v]] = v;
+            reorderedVertices[v] = vertices[originalVertexIds[v]];
+        });
+        vertices.swap(reorderedVertices);
+        reorderedVertices = std::vector<VertexType>();
+
+        std::vector<Index> originalTriangleIds = sortedOrder<Index>(nTriangles, [&](size_t t) {
+            const VertexType& v0 = vertices[newVertexIds[faces[3 * t]]];
+            const VertexType& v1 = vertices[newVertexIds[faces[3 * t + 1]]];
+            const VertexType& v2 = vertices[newVertexIds[faces[3 * t + 2]]];
+            return hilbertKey((v0.x + v1.x + v2.x) / 3.0, (v0.y + v1.y + v2.y) / 3.0);
+        });
+        std::vector<Index> newTriangleIds(nTriangles);
+        parallel::forEach(0, nTriangles, [&](size_t t) {
+            newTriangleIds[originalTriangleIds[t]] = t;
+        });
+        std::vector<Index> reorderedFaces(faces.size());
+        parallel::forEach(0, nTriangles, [&](size_t t) {
+            Index original = originalTriangleIds[t];
+            for (size_t j = 0; j < 3; ++j) {
+                reorderedFaces[3 * t + j] = newVertexIds[faces[3 * original + j]];
+            }
+        });
+        faces.swap(reorderedFaces);
+        if (!neighbors.empty()) {
+            std::vector<Index> reorderedNeighbors(neighbors.size());
+            parallel::forEach(0, nTriangles, [&](size_t t) {
+                Index original = originalTriangleIds[t];
+                for (size_t j = 0; j < 3; ++j) {
+                    Index neighbor = neighbors[3 * original + j];
+                    reorderedNeighbors[3 * t + j] = neighbor < 0 ? neighbor : newTriangleIds[neighbor];
+                }
+            });
+            neighbors.swap(reorderedNeighbors);
+        }
+        return originalVertexIds;
+    }
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef COMPACT_HALF_EDGE_HPP
+#define COMPACT_HALF_EDGE_HPP
+
+/**
+ * Half edge without a `prev` link and with the border flag folded into the high bit of `face`,
+ * so a record takes 16 bytes instead of the 24 of `HalfEdge`
+ */
+struct CompactHalfEdge {
+    int origin; //tail of edge
+    int twin; //opposite halfedge
+    int next; //next halfedge of the same face
+    int face : 31; //face index incident to the halfedge
+    unsigned int isBorder : 1; //1 if the halfedge is on the boundary, 0 otherwise
+
+    bool operator==(const CompactHalfEdge& other) const {
+        return origin == other.origin &&
+        next == other.next &&
+        twin == other.twin &&
+        face == other.face &&
+        isBorder == other.isBorder;
+    }
+};
+static_assert(sizeof(CompactHalfEdge) == 16);
+
+#endif
@@ -1,14 +1,17 @@
 #ifndef HALF_EDGE_HPP
 #define HALF_EDGE_HPP
-struct HalfEdge {
-    int origin; //tail of edge
-    //int target; //head of edge
-    int twin; //opposite halfedge
-    int next; //next halfedge of the same face
-    int prev; //previous halfedge of the same face
-    int face; //face index incident to the halfedge
+#include <concepts/primitive_integral.hpp>
+
+template <PrimitiveIntegral Index>
+struct BasicHalfEdge {
+    Index origin; //tail of edge
+    //Index target; //head of edge
+    Index twin; //opposite halfedge
+    Index next; //next halfedge of the same face
+    Index prev; //previous halfedge of the same face
+    Index face; //face index incident to the halfedge
     bool isBorder; //1 if the halfedge is on the boundary, 0 otherwise
-    bool operator==(const HalfEdge& other) const {
+    bool operator==(const BasicHalfEdge& other) const {
         return origin == other.origin && 
         next == other.next && 
         twin == other.twin && 
@@ -18,4 +21,6 @@ struct HalfEdge {
     }
 };
 
+using HalfEdge = BasicHalfEdge<int>;
+
 #endif
\ No newline at end of file
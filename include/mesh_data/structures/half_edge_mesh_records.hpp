@@ -0,0 +1,19 @@
+#ifndef HALF_EDGE_MESH_RECORDS_HPP
+#define HALF_EDGE_MESH_RECORDS_HPP
+#include <vector>
+#include <cstddef>
+
+/**
+ * The already linked arrays of a half edge mesh, so a mesh can be rebuilt as is without reconstructing its twins
+ */
+template <typename VertexType, typename EdgeType, typename FaceIndex>
+struct HalfEdgeMeshRecords {
+    std::vector<VertexType> vertices;
+    std::vector<EdgeType> halfEdges;
+    std::vector<FaceIndex> polygons;
+    size_t nVertices = 0;
+    size_t nHalfEdges = 0;
+    size_t nPolygons = 0;
+};
+
+#endif
@@ -1,12 +1,18 @@
 #ifndef HE_VERTEX_HPP
 #define HE_VERTEX_HPP
 #include <mesh_data/structures/vertex.hpp>
+#include <concepts>
 #include <concepts/is_half_edge_vertex.hpp>
-struct HEVertex : public Vertex {
-    int incidentHalfEdge;
+#include <concepts/primitive_integral.hpp>
+
+template <PrimitiveIntegral Index, std::floating_point Scalar = DefaultVertexScalar>
+struct BasicHEVertex : public BasicVertex<Scalar> {
+    Index incidentHalfEdge;
     bool isBorder;
 
 };
+
+using HEVertex = BasicHEVertex<int>;
 static_assert(IsHalfEdgeVertex<HEVertex>);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef LINK_OVERRIDE_TABLE_HPP
+#define LINK_OVERRIDE_TABLE_HPP
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <concepts/primitive_integral.hpp>
+
+/**
+ * Table for the links of a mesh that can usually be computed from an index alone (for example the `prev` of an edge of an
+ * unmodified triangle), only the links that stopped following that implicit value are stored.
+ *
+ * The keys are split in fixed size pages that hold one value per key and are allocated the first time one of their keys
+ * is overridden, so a lookup is two array reads and overrides that are close together (like the exterior edges at the
+ * end of a mesh, or the edges of a cavity) cost `sizeof(Index)` bytes each instead of a hash node
+ */
+template <PrimitiveIntegral Index>
+class LinkOverrideTable {
+    private:
+        static constexpr unsigned int pageBits = 10;
+        static constexpr size_t pageSize = size_t{1} << pageBits;
+        /**
+         * Marks the keys of an allocated page that follow their implicit value, it's neither a valid index nor the invalid index `-1`
+         */
+        static constexpr Index absent = std::is_signed_v<Index> ? std::numeric_limits<Index>::min() : std::numeric_limits<Index>::max() - 1;
+        /**
+         * Empty for the pages that haven't been allocated
+         */
+        std::vector<std::vector<Index>> pages;
+        size_t overrideCount = 0;
+    public:
+        /**
+         * @return The value stored for `key`, or `implicitValue` if it hasn't been overridden
+         */
+        Index get(Index key, Index implicitValue) const {
+            size_t page = static_cast<size_t>(key) >> pageBits;
+            if (page >= pages.size() || pages[page].empty()) {
+                return implicitValue;
+            }
+            Index value = pages[page][static_cast<size_t>(key) & (pageSize - 1)];
+            return value == absent ? implicitValue : value;
+        }
+        /**
+         * Stores `value` for `key`, or drops the entry if it matches the implicit value again.
+         *
+         * Setting the implicit value of a key whose page isn't allocated doesn't touch the table, so it's safe to do concurrently
+         */
+        void set(Index key, Index value, Index implicitValue) {
+            size_t page = static_cast<size_t>(key) >> pageBits;
+            size_t offset = static_cast<size_t>(key) & (pageSize - 1);
+            if (value == implicitValue) {
+                if (page < pages.size() && !pages[page].empty() && pages[page][offset] != absent) {
+                    pages[page][offset] = absent;
+                    --overrideCount;
+                }
+                return;
+            }
+            if (page >= pages.size()) {
+                pages.resize(page + 1);
+            }
+            if (pages[page].empty()) {
+                pages[page].assign(pageSize, absent);
+            }
+            if (pages[page][offset] == absent) {
+                ++overrideCount;
+            }
+            pages[page][offset] = value;
+        }
+        size_t size() const {
+            return overrideCount;
+        }
+        size_t getMemoryUsage() const {
+            size_t memory = sizeof(std::vector<Index>) * pages.capacity();
+            for (const std::vector<Index>& page : pages) {
+                memory += sizeof(Index) * page.capacity();
+            }
+            return memory;
+        }
+};
+
+#endif
@@ -1,5 +1,5 @@
 /**
- * This code contains the inCircle test adapted from Triangle
+ * This code contains the inCircle and orientation tests adapted from Triangle
  */
 /*****************************************************************************/
 /*                                                                           */
@@ -200,31 +200,275 @@
 #ifndef VERTEX_HPP
 #define VERTEX_HPP
 #include<cmath>
+#include<concepts>
 #include<stdexcept>
 #include<format>
+#include<vector>
+#include<atomic>
 #define EPSILON 1e-9
+
 /**
- * Basic vertex structure with x,y coordinates
+ * Adaptive orientation and incircle tests after Shewchuk's predicates in Triangle.
+ *
+ * Each test first evaluates its determinant in plain double arithmetic and returns it if it's farther from 0 than
+ * the worst case rounding error, otherwise it counts a filter failure and recomputes the determinant as an exact
+ * expansion, so the sign of the result is always correct for the double inputs.
  */
-struct Vertex{
-    double x;
-    double y;
+namespace predicates {
+    inline constexpr double epsilon = 0x1p-53;
+    inline constexpr double ccwErrorBound = (3.0 + 16.0 * epsilon) * epsilon;
+    inline constexpr double iccErrorBound = (10.0 + 96.0 * epsilon) * epsilon;
+
+    /**
+     * Times the fast path of `orient2d` couldn't decide the sign of the determinant
+     */
+    inline std::atomic<unsigned long long> orient2dFilterFailures{0};
+    /**
+     * Times the fast path of `incircle` couldn't decide the sign of the determinant
+     */
+    inline std::atomic<unsigned long long> incircleFilterFailures{0};
+
+    /**
+     * A sum of doubles ordered by increasing magnitude where no two components overlap, zero components are dropped
+     */
+    using Expansion = std::vector<double>;
+
+    /**
+     * `a` + `b` = `sum` + `error` exactly, with `sum` the rounded sum
+     */
+    inline void twoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        double bVirtual = sum - a;
+        double aVirtual = sum - bVirtual;
+        error = (a - aVirtual) + (b - bVirtual);
+    }
+
+    /**
+     * Same as `twoSum` for |`a`| >= |`b`|
+     */
+    inline void fastTwoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        error = b - (sum - a);
+    }
+
+    /**
+     * `a` * `b` = `product` + `error` exactly, with `product` the rounded product
+     */
+    inline void twoProduct(double a, double b, double& product, double& error) {
+        product = a * b;
+        error = std::fma(a, b, -product);
+    }
+
+    /**
+     * @return `a` - `b` as an exact expansion
+     */
+    inline Expansion difference(double a, double b) {
+        double sum, error;
+        twoSum(a, -b, sum, error);
+        Expansion result;
+        if (error != 0.0) result.push_back(error);
+        if (sum != 0.0) result.push_back(sum);
+        return result;
+    }
+
+    /**
+     * @return `e` + `b` as an exact expansion
+     */
+    inline Expansion grow(const Expansion& e, double b) {
+        Expansion result;
+        result.reserve(e.size() + 1);
+        double q = b;
+        for (double component : e) {
+            double error;
+            twoSum(q, component, q, error);
+            if (error != 0.0) result.push_back(error);
+        }
+        if (q != 0.0) result.push_back(q);
+        return result;
+    }
+
+    /**
+     * @return `e` + `f` as an exact expansion
+     */
+    inline Expansion sum(const Expansion& e, const Expansion& f) {
+        Expansion result = e;
+        for (double component : f) {
+            result = grow(result, component);
+        }
+        return result;
+    }
+
+    /**
+     * @return `e` * `b` as an exact expansion
+     */
+    inline Expansion scale(const Expansion& e, double b) {
+        Expansion result;
+        if (e.empty() || b == 0.0) {
+            return result;
+        }
+        result.reserve(2 * e.size());
+        double q, error;
+        twoProduct(e[0], b, q, error);
+        if (error != 0.0) result.push_back(error);
+        for (size_t i = 1; i < e.size(); ++i) {
+            double productHigh, productLow, partial;
+            twoProduct(e[i], b, productHigh, productLow);
+            twoSum(q, productLow, partial, error);
+            if (error != 0.0) result.push_back(error);
+            fastTwoSum(productHigh, partial, q, error);
+            if (error != 0.0) result.push_back(error);
+        }
+        if (q != 0.0) result.push_back(q);
+        return result;
+    }
+
+    /**
+     * @return `e` * `f` as an exact expansion
+     */
+    inline Expansion product(const Expansion& e, const Expansion& f) {
+        Expansion result;
+        for (double component : f) {
+            result = sum(result, scale(e, component));
+        }
+        return result;
+    }
+
+    /**
+     * @return `-e`
+     */
+    inline Expansion negate(Expansion e) {
+        for (double& component : e) {
+            component = -component;
+        }
+        return e;
+    }
+
+    /**
+     * @return An approximation of the value of `e` with its exact sign
+     */
+    inline double estimate(const Expansion& e) {
+        double result = 0.0;
+        for (double component : e) {
+            result += component;
+        }
+        return result;
+    }
+
+    inline double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy) {
+        Expansion left = product(difference(ax, cx), difference(by, cy));
+        Expansion right = product(difference(ay, cy), difference(bx, cx));
+        return estimate(sum(left, negate(right)));
+    }
+
+    /**
+     * @return A positive value if `a`, `b`, `c` are in counter-clockwise order, negative if clockwise and 0 if collinear
+     */
+    inline double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+        double detLeft = (ax - cx) * (by - cy);
+        double detRight = (ay - cy) * (bx - cx);
+        double det = detLeft - detRight;
+        double detSum;
+        // Both products having different signs (or one being 0) means no cancellation can happen
+        if (detLeft > 0.0) {
+            if (detRight <= 0.0) return det;
+            detSum = detLeft + detRight;
+        } else if (detLeft < 0.0) {
+            if (detRight >= 0.0) return det;
+            detSum = -detLeft - detRight;
+        } else {
+            return det;
+        }
+        double errorBound = ccwErrorBound * detSum;
+        if (det >= errorBound || -det >= errorBound) {
+            return det;
+        }
+        orient2dFilterFailures.fetch_add(1, std::memory_order_relaxed);
+        return orient2dExact(ax, ay, bx, by, cx, cy);
+    }
+
+    inline double incircleExact(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        Expansion adx = difference(ax, dx), ady = difference(ay, dy);
+        Expansion bdx = difference(bx, dx), bdy = difference(by, dy);
+        Expansion cdx = difference(cx, dx), cdy = difference(cy, dy);
+        auto lift = [](const Expansion& x, const Expansion& y) {
+            return sum(product(x, x), product(y, y));
+        };
+        auto cross = [](const Expansion& x1, const Expansion& y1, const Expansion& x2, const Expansion& y2) {
+            return sum(product(x1, y2), negate(product(y1, x2)));
+        };
+        Expansion aTerm = product(lift(adx, ady), cross(bdx, bdy, cdx, cdy));
+        Expansion bTerm = product(lift(bdx, bdy), cross(cdx, cdy, adx, ady));
+        Expansion cTerm = product(lift(cdx, cdy), cross(adx, ady, bdx, bdy));
+        return estimate(sum(sum(aTerm, bTerm), cTerm));
+    }
+
+    /**
+     * @return A positive value if `d` lies inside the circle through the counter-clockwise triangle `a`, `b`, `c`,
+     * negative if it lies outside and 0 if the four points are cocircular
+     */
+    inline double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy) {
+        double adx = ax - dx, ady = ay - dy;
+        double bdx = bx - dx, bdy = by - dy;
+        double cdx = cx - dx, cdy = cy - dy;
+
+        double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+        double aLift = adx * adx + ady * ady;
+        double cdxady = cdx * ady, adxcdy = adx * cdy;
+        double bLift = bdx * bdx + bdy * bdy;
+        double adxbdy = adx * bdy, bdxady = bdx * ady;
+        double cLift = cdx * cdx + cdy * cdy;
+
+        double det = aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady);
+        double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * aLift
+                         + (std::fabs(cdxady) + std::fabs(adxcdy)) * bLift
+                         + (std::fabs(adxbdy) + std::fabs(bdxady)) * cLift;
+        double errorBound = iccErrorBound * permanent;
+        if (det > errorBound || -det > errorBound) {
+            return det;
+        }
+        incircleFilterFailures.fetch_add(1, std::memory_order_relaxed);
+        return incircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+}
+
+template <std::floating_point S>
+struct BasicVertex;
+
+/**
+ * Vertex with double precision coordinates, every geometric predicate is computed with it
+ */
+using Vertex = BasicVertex<double>;
+
+/**
+ * Basic vertex structure with x,y coordinates stored as `S`.
+ * Predicates promote the coordinates to double, so storing them as float only loses precision on the input points
+ */
+template <std::floating_point S>
+struct BasicVertex{
+    using Scalar = S;
+    Scalar x;
+    Scalar y;
     /**
      * Dot product of `this` and vertex `v`
      */
-    inline double dot(Vertex v) const {
-        return x * v.x + y * v.y;
+    inline double dot(BasicVertex v) const {
+        return static_cast<double>(x) * v.x + static_cast<double>(y) * v.y;
     }
     /**
      * Z coordinate of cross product between (`v1` - `this`) and (`v2` - `this`)
      */
-    inline double cross2d(Vertex v1, Vertex v2) const {
-        Vertex v1v0 = v1 - *this;
-        Vertex v2v0 = v2 - *this;
-        return (v1v0.x * v2v0.y) - (v1v0.y * v2v0.x);
+    inline double cross2d(BasicVertex v1, BasicVertex v2) const {
+        double v1v0x = static_cast<double>(v1.x) - x;
+        double v1v0y = static_cast<double>(v1.y) - y;
+        double v2v0x = static_cast<double>(v2.x) - x;
+        double v2v0y = static_cast<double>(v2.y) - y;
+        return (v1v0x * v2v0y) - (v1v0y * v2v0x);
     }
 
-    static Vertex findCircumcenter(const Vertex& vertex0, const Vertex& vertex1, const Vertex& vertex2) {
+    static Vertex findCircumcenter(const BasicVertex& v0, const BasicVertex& v1, const BasicVertex& v2) {
+        Vertex vertex0 = v0;
+        Vertex vertex1 = v1;
+        Vertex vertex2 = v2;
         Vertex origin;
         origin.x = 0;
         origin.y = 0;
@@ -248,40 +492,53 @@ struct Vertex{
         circumcenter.x = circumcenterX;
         circumcenter.y = circumcenterY;
         return circumcenter;
+    }
+    /**
+     * Sign exact orientation test, see `predicates::orient2d`
+     * @return A positive value if `a`, `b`, `c` are in counter-clockwise order, negative if clockwise and 0 if collinear
+     */
+    static double orient2d(const BasicVertex& a, const BasicVertex& b, const BasicVertex& c) {
+        return predicates::orient2d(a.x, a.y, b.x, b.y, c.x, c.y);
     }
      /**
-     * Returns true if point `P` lies inside the circumcircle of triangle ABC or is cocircular.
+     * Returns true if point `P` lies inside the circumcircle of triangle ABC or is cocircular, decided exactly.
      * Assumes triangle ABC is oriented counter-clockwise (CCW).
      */
-    static bool inCircle(const Vertex& A, const Vertex& B, const Vertex& C, const Vertex& P) {
-        Vertex pa = A - P;
-        Vertex pb = B - P;
-        Vertex pc = C - P;
-
-        double paLenSq = pa.dot(pa);
-        double pbLenSq = pb.dot(pb);
-        double pcLenSq = pc.dot(pc);
-
-        double det = paLenSq * P.cross2d(B,C)
-                   + pbLenSq * P.cross2d(C,A)
-                   + pcLenSq * P.cross2d(A,B);
+    static bool inCircle(const BasicVertex& A, const BasicVertex& B, const BasicVertex& C, const BasicVertex& P) {
+        return predicates::incircle(A.x, A.y, B.x, B.y, C.x, C.y, P.x, P.y) >= 0;
+    }
 
-        return det >= 0 || std::fabs(det) < EPSILON;
+    /**
+     * The same point with `Other` coordinates
+     */
+    template <std::floating_point Other> requires (!std::same_as<Other, Scalar>)
+    operator BasicVertex<Other>() const {
+        return BasicVertex<Other>{static_cast<Other>(x), static_cast<Other>(y)};
     }
 
-    Vertex operator+(const Vertex& other) const {
-        return Vertex{x + other.x, y + other.y};
+    BasicVertex operator+(const BasicVertex& other) const {
+        return BasicVertex{x + other.x, y + other.y};
     }
-    Vertex operator-(const Vertex& other) const {
-        return Vertex{x - other.x, y - other.y};
+    BasicVertex operator-(const BasicVertex& other) const {
+        return BasicVertex{x - other.x, y - other.y};
     }
-    Vertex operator*(double scalar) const {
-        return Vertex{x*scalar, y*scalar};
+    BasicVertex operator*(double scalar) const {
+        return BasicVertex{static_cast<Scalar>(x*scalar), static_cast<Scalar>(y*scalar)};
     }
-    bool operator==(const Vertex& other) const {
+    bool operator==(const BasicVertex& other) const {
         return std::fabs(x - other.x) < EPSILON && std::fabs(y - other.y) < EPSILON;
     }
 };
 
+/**
+ * The scalar the coordinates of mesh vertices are stored as, it can be set with the `VERTEX_SCALAR_T` macro,
+ * otherwise it's double
+ */
+#if defined(VERTEX_SCALAR_T)
+using DefaultVertexScalar = VERTEX_SCALAR_T;
+#else
+using DefaultVertexScalar = double;
+#endif
+
 #undef EPSILON
 #endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef WIDE_INDEX_MESH_HPP
+#define WIDE_INDEX_MESH_HPP
+#include <cstddef>
+#include <limits>
+#include <concepts/mesh_data.hpp>
+
+/**
+ * The variant of `Mesh` that uses 64 bit indices.
+ *
+ * Mesh types that have one specialize this right after their definition (like `isMeshData`),
+ * every other mesh type is its own wide variant.
+ */
+template <MeshData Mesh>
+struct WideIndexMesh {
+    using type = Mesh;
+};
+
+template <MeshData Mesh>
+using WideIndexMeshT = typename WideIndexMesh<Mesh>::type;
+
+/**
+ * Whether a triangulation of `nVertices` vertices and `nTriangles` triangles can be stored using the indices of `Mesh`.
+ *
+ * Each triangle has 3 interior half edges and each of them adds at most one exterior half edge,
+ * so `6 * nTriangles` bounds the amount of half edges of the mesh.
+ */
+template <MeshData Mesh>
+constexpr bool indicesFit(size_t nVertices, size_t nTriangles) {
+    constexpr auto maxVertexIndex = static_cast<unsigned long long>(std::numeric_limits<typename Mesh::VertexIndex>::max());
+    constexpr auto maxEdgeIndex = static_cast<unsigned long long>(std::numeric_limits<typename Mesh::EdgeIndex>::max());
+    constexpr auto maxFaceIndex = static_cast<unsigned long long>(std::numeric_limits<typename Mesh::FaceIndex>::max());
+    return nVertices <= maxVertexIndex && nTriangles <= maxEdgeIndex / 6 && nTriangles <= maxFaceIndex;
+}
+
+#endif
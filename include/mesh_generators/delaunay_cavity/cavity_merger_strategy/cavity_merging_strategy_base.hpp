@@ -3,15 +3,18 @@
 #include <concepts/mesh_data.hpp>
 #include <concepts/polygon_merging_policy_concept.hpp>
 #include <mesh_generators/delaunay_cavity/helper_structs/cavity.hpp>
+#include <mesh_generators/delaunay_cavity/helper_structs/delaunay_cavity_data.hpp>
 #include <vector>
 #include <mesh_generators/delaunay_cavity/mesh_helpers/mesh_helper_delaunay_cavity.hpp>
 
 template <MeshData Mesh, PolygonMergingPolicy<Mesh> MergingPolicy>
 struct CavityMergingStrategyBase {
     using Cavity = generators::helpers::delaunay_cavity::Cavity<Mesh>;
+    using CavitySet = generators::helpers::delaunay_cavity::CavitySet<Mesh>;
     using FaceIndex = typename Mesh::FaceIndex;
     using MeshVertex = typename Mesh::VertexType;
     using OutputIndex = typename Mesh::OutputIndex;
+    using CavityStamp = typename DelaunayCavityData<Mesh>::CavityStamp;
     protected:
         using _MeshHelper = generators::helpers::delaunay_cavity::MeshHelper<Mesh>;
 };
@@ -7,11 +7,17 @@ template <MeshData Mesh, PolygonMergingPolicy<Mesh> MergingPolicy>
 struct ExcludePreviousCavitiesStrategyBase : CavityMergingStrategyBase<Mesh, MergingPolicy> {
     using Base = CavityMergingStrategyBase<Mesh,MergingPolicy>;
     using typename Base::Cavity;
+    using typename Base::CavitySet;
     using typename Base::FaceIndex;
     using typename Base::MeshVertex;
     using typename Base::OutputIndex;
+    using typename Base::CavityStamp;
     using typename Base::_MeshHelper;
-    static bool preAdd(FaceIndex triangle, const std::vector<uint8_t>& inCavity) {
+    /**
+     * A triangle already in a cavity can't be added to another one
+     */
+    static constexpr bool disjointCavities = true;
+    static bool preAdd(FaceIndex triangle, const std::vector<CavityStamp>& inCavity) {
         return !inCavity[triangle];
     }
 };
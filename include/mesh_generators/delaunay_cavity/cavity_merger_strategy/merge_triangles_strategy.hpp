@@ -17,14 +17,22 @@ struct MergeTrianglesStrategyBase : ExcludePreviousCavitiesStrategyBase<Mesh, Me
     static void postInsertion(const Mesh* inputMesh, Mesh* outputMesh, DelaunayCavityData<Mesh>& generatorData) {
         size_t seedAmount = generatorData.outputSeeds.size();
         generators::helpers::delaunay_cavity::UnionFindCavityMerger<Mesh> edgeToOutputMap = _MeshHelper::buildEdgeToOutputMap(outputMesh, generatorData.outputSeeds);
+        // Computed from the input mesh, whose edges have the same endpoints and still count every half edge
+        EdgeLengthCache<Mesh> edgeLengths;
         for (size_t i = 0; i < seedAmount; ++i) {
             if (generatorData.isValidSeed(i) && outputMesh->getOutputSeedEdgeCount(generatorData.outputSeeds[i]) == 3) {
-                _MeshHelper::template mergeIntoNeighbor<MergingPolicy>(inputMesh, outputMesh, generatorData.outputSeeds, generatorData.outputSeeds[i], edgeToOutputMap);
+                if constexpr (EdgeLengthMergingPolicy<MergingPolicy,Mesh>) {
+                    if (edgeLengths.empty()) {
+                        edgeLengths.compute(inputMesh);
+                    }
+                }
+                _MeshHelper::template mergeIntoNeighbor<MergingPolicy>(inputMesh, outputMesh, generatorData.outputSeeds, generatorData.outputSeeds[i], edgeToOutputMap, edgeLengths);
             }
         }
         generatorData.removeInvalidSeeds();
 
         generatorData.memoryStats[M_EDGE_MAP] =  edgeToOutputMap.memoryUsage();
+        generatorData.memoryStats[M_EDGE_LENGTH_CACHE] = edgeLengths.memoryUsage();
 
     }
 };
@@ -1,6 +1,7 @@
 #ifndef EDGE_LENGTH_BASED_MERGING_POLICY
 #define EDGE_LENGTH_BASED_MERGING_POLICY
 #include <concepts/mesh_data.hpp>
+#include <misc/edge_length_cache.hpp>
 #include <limits>
 
 template <MeshData Mesh, typename Derived>
@@ -14,13 +15,13 @@ struct EdgeLengthBasedMergingPolicy {
         static double initialValue() {
             return Derived::initialValueImpl();
         }
-    public:
-        static OutputIndex mergeBestCandidate(Mesh* mesh, OutputIndex seedToMerge, std::vector<OutputIndex>& seedNeighbors, std::vector<std::vector<EdgeIndex>>& sharedEdges) {
+        template <typename EdgeLength2>
+        static OutputIndex mergeBestCandidateBy(Mesh* mesh, EdgeLength2&& edgeLength2, OutputIndex seedToMerge, std::vector<OutputIndex>& seedNeighbors, std::vector<std::vector<EdgeIndex>>& sharedEdges) {
             int bestCandidateIndex = 0;
             double bestCandidateLength = initialValue();
             for (int i = 0; i < seedNeighbors.size(); ++i) {
                 for (EdgeIndex edge : sharedEdges[i]) {
-                    double newCandidateLength = mesh->edgeLength2(edge);
+                    double newCandidateLength = edgeLength2(edge);
                     bestCandidateIndex = isBetterCandidate(bestCandidateLength, newCandidateLength) ? i : bestCandidateIndex;
                     if (bestCandidateIndex == i) {
                         bestCandidateLength = newCandidateLength;
@@ -30,6 +31,16 @@ struct EdgeLengthBasedMergingPolicy {
             mesh->mergeSeeds(seedNeighbors[bestCandidateIndex], std::pair<OutputIndex, std::vector<EdgeIndex>>{seedToMerge, sharedEdges[bestCandidateIndex]});
             return seedNeighbors[bestCandidateIndex];
         }
+    public:
+        static OutputIndex mergeBestCandidate(Mesh* mesh, OutputIndex seedToMerge, std::vector<OutputIndex>& seedNeighbors, std::vector<std::vector<EdgeIndex>>& sharedEdges) {
+            return mergeBestCandidateBy(mesh, [mesh](EdgeIndex edge) { return mesh->edgeLength2(edge); }, seedToMerge, seedNeighbors, sharedEdges);
+        }
+        /**
+         * Same as the other overload, reading the edge lengths from `edgeLengths`
+         */
+        static OutputIndex mergeBestCandidate(Mesh* mesh, const EdgeLengthCache<Mesh>& edgeLengths, OutputIndex seedToMerge, std::vector<OutputIndex>& seedNeighbors, std::vector<std::vector<EdgeIndex>>& sharedEdges) {
+            return mergeBestCandidateBy(mesh, [&edgeLengths](EdgeIndex edge) { return edgeLengths[edge]; }, seedToMerge, seedNeighbors, sharedEdges);
+        }
 };
 
 
@@ -3,7 +3,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <cstdint>
-#include <queue>
+#include <bit>
 #include <array>
 #include <misc/mesh_stat.hpp>
 #include <misc/time_stat.hpp>
@@ -14,17 +14,24 @@
 #include <concepts/selection_criterion.hpp>
 #include <concepts/triangle_comparator.hpp>
 #include <concepts/is_half_edge_vertex.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
 #include <mesh_data/structures/vertex.hpp>
+#include <misc/incircle_batch.hpp>
+#include <misc/triangle_quality_cache.hpp>
+#include <misc/parallel.hpp>
 #include <mesh_data/half_edge_mesh.hpp>
 #include <mesh_generators/mesh_generator.hpp>
 #include <mesh_generators/delaunay_cavity/mesh_helpers/mesh_helper_delaunay_cavity.hpp>
 #include <mesh_generators/delaunay_cavity/helper_structs/cavity.hpp>
+#include <mesh_generators/delaunay_cavity/helper_structs/circumcircle_table.hpp>
 #include <mesh_generators/selection_criteria/null_selection_criterion.hpp>
 #include <numeric>
 #include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cmath>
+#include <limits>
+#include <memory>
 
 #define DELAUNAY_CAVITY_GENERATOR_TEMPLATE \
 template < \
@@ -43,8 +50,10 @@ class DelaunayCavityGenerator : public MeshGenerator<MeshType> {
         using EdgeIndex = typename MeshType::EdgeIndex;
         using FaceIndex = typename MeshType::FaceIndex;
         using OutputIndex = typename MeshType::OutputIndex;
+        using CavityStamp = typename DelaunayCavityData<MeshType>::CavityStamp;
     private:
         bool storeMeshBeforePostProcess = false;
+        bool precomputeCircumcircles = false;
 
         MeshType* meshBeforePostProcess = nullptr;
         DelaunayCavityData<MeshType> data;
@@ -58,42 +67,77 @@ class DelaunayCavityGenerator : public MeshGenerator<MeshType> {
         #endif
         
         NO_UNIQUE_ADDRESS maybe_output_vector outputSeedsBeforePostProcess = maybe_output_vector{};
+        /**
+         * Only the random comparator has state, its seed
+         */
+        NO_UNIQUE_ADDRESS Comparator comparator;
         #undef NO_UNIQUE_ADDRESS
 
         Criterion selectionCriterion;
 
         using _MeshHelper = generators::helpers::delaunay_cavity::MeshHelper<MeshType>;
         using _Cavity = generators::helpers::delaunay_cavity::Cavity<MeshType>;
+        using _CavitySet = generators::helpers::delaunay_cavity::CavitySet<MeshType>;
+        using _CircumcircleTable = generators::helpers::delaunay_cavity::CircumcircleTable;
+        /**
+         * Circumcircles of the triangles of the mesh being refined, only filled while computing cavities if `precomputeCircumcircles` is set
+         */
+        _CircumcircleTable circumcircleTable;
+        /**
+         * Metrics the selection criterion and comparator read from `qualityCache`, 0 if neither reads it
+         */
+        static constexpr unsigned int qualityMetrics = criterionQualityMetrics<Criterion,MeshType> | comparatorQualityMetrics<Comparator,MeshType>;
+        /**
+         * Quality metrics of the triangles of the mesh being refined, only filled while sorting them
+         */
+        TriangleQualityCache qualityCache;
+        /**
+         * Evaluates the selection criterion on `triangle`, from `qualityCache` when the criterion supports it
+         */
+        bool matchesCriterion(const MeshType* outputMesh, FaceIndex triangle) const {
+            if constexpr (CachedSelectionCriterion<Criterion,MeshType>) {
+                return selectionCriterion(qualityCache, triangle);
+            } else {
+                return selectionCriterion(outputMesh, triangle);
+            }
+        }
         /**
          * Sorts the triangles before computing the cavities using the provided `TriangleComparator` template type
          * 
-         * Note that this method could also shuffle the triangles or do a noop depending on the comparator
+         * Note that this method could also shuffle the triangles or do a noop depending on the comparator.
+         * Triangles matching the selection criterion go first in their original order, the rest follow sorted by the comparator,
+         * both done by a single radix sort over `sortKey` computed once per triangle in parallel. A shuffle sorts by the random
+         * bits of each triangle, so it is the same for a given seed whatever the number of threads.
+         * The metrics the criterion and comparator need are computed beforehand in a single pass into `qualityCache`
          * @param outputMesh The mesh whose triangles will be sorted
          * @return A vector of `FaceIndex` with the indices of the triangles sorted according to the `TriangleComparator`
          */
         std::vector<FaceIndex> sortTriangles(MeshType* outputMesh);
         /**
-         * Computes the cavities for the mesh given a vector of circumcenter,triangle pairs and a vector to check if a triangle has been visited or not
+         * Bits of the keys returned by `sortKey`, the highest one being set for triangles that don't match the selection criterion
+         */
+        static constexpr unsigned int sortKeyBits = isNullComparator<Comparator,MeshType> ? 1 : 64;
+        /**
+         * @return A key whose unsigned order is the order `sortTriangles` puts `triangle` in, ties keep the triangle order
+         */
+        std::uint64_t sortKey(const MeshType* outputMesh, FaceIndex triangle) const;
+        /**
+         * Computes the cavities for the mesh given a vector of circumcenter,triangle pairs
          * 
-         * To compute the cavities, a BFS search is done starting from a circumcenter, the visited vector is created once and reused accross searches
+         * To compute the cavities, a BFS search is done starting from a circumcenter. Each search stamps the triangles it visits in `data.inCavity`
+         * with the number of its cavity, so telling whether a triangle was visited by the current search doesn't need clearing anything between searches.
+         * The search goes one level at a time so the incircle tests of every unvisited neighbor of a level are done together in a batch
          * 
          * @param inputMesh The mesh for which to compute the cavities
          * @param sortedTriangles A vector of `FaceIndex` with the indices of the triangles sorted according to the `TriangleComparator`
-         * @return A vector of `Cavity` objects with the required information to insert a cavity into the mesh.
+         * @return A `CavitySet` with the required information to insert a cavity into the mesh.
          */
-        std::vector<_Cavity> computeCavities(const MeshType* inputMesh, const std::vector<FaceIndex>& sortedTriangles);
-
+        _CavitySet computeCavities(const MeshType* inputMesh, const std::vector<FaceIndex>& sortedTriangles);
         /**
-         * Resets the BFS `visited` vector to perform a new search starting from another circumcenter
-         * @param visited A vector of 8-bit unsigned integers used as a yes or no check. 8-bit integers are preferred over a vector of booleans for
-         * memory aligment and performance reasons
-         * @param cavity A cavity object that was created within a call of `computeCavities`
+         * Replaces the contents of `batch` with the vertices of `triangles`, prefetching the vertices of all of them
+         * before reading any when the mesh allows it
          */
-        inline void resetVisited(std::vector<uint8_t>& visited, const _Cavity& cavity) {
-            for (FaceIndex triangle: cavity.allTriangles) {
-                visited[triangle] = 0;
-            }
-        }
+        void loadTriangleBatch(const MeshType* inputMesh, const std::vector<FaceIndex>& triangles, incircle_batch::Batch& batch);
         
     public:
         MeshType* generateMesh(const MeshType* inputMesh) override;
@@ -105,6 +149,21 @@ class DelaunayCavityGenerator : public MeshGenerator<MeshType> {
         explicit DelaunayCavityGenerator(bool storeBeforePostProcess = false) requires std::same_as<Criterion, NullSelectionCriterion<MeshType>>
         : DelaunayCavityGenerator(NullSelectionCriterion<MeshType>(), storeBeforePostProcess) {}
 
+        /**
+         * Whether to compute the circumcircle of every triangle before the cavities, so the cavity search compares squared
+         * distances instead of doing incircle tests and degenerate triangles don't stop the generation
+         */
+        void setPrecomputeCircumcircles(bool precompute) {
+            precomputeCircumcircles = precompute;
+        }
+
+        /**
+         * Seeds the random order of the triangles, the same seed always gives the same order
+         */
+        void setRandomSeed(std::uint64_t seed) requires isRandomComparator<Comparator,MeshType> {
+            comparator = Comparator(seed);
+        }
+
 
         const std::unordered_map<MeshStat,int>& getGenerationStats() override {
             return data.meshStats;
@@ -1,19 +1,121 @@
 #ifndef CAVITY_HPP
 #define CAVITY_HPP
 #include <concepts/mesh_data.hpp>
+#include <cstddef>
+#include <span>
 #include <vector>
 
 namespace generators::helpers::delaunay_cavity {
+    /**
+     * View of a single cavity stored in a `CavitySet`, it stays valid until the set is modified
+     */
     template <MeshData Mesh>
     struct Cavity {
         private:
             using FaceIndex = typename Mesh::FaceIndex;
             using EdgeIndex = typename Mesh::EdgeIndex;
         public:
+            std::span<const FaceIndex> allTriangles;
+            std::span<const FaceIndex> interior;
+            std::span<const FaceIndex> boundaryTriangles;
+            std::span<const EdgeIndex> boundaryEdges;
+    };
+
+    /**
+     * Every cavity computed by a generator, the lists of all cavities are stored back to back in one array per list
+     * and each cavity keeps where its part of each array starts, like a compressed sparse row matrix.
+     *
+     * Cavities are built one at a time, `emplace_back` starts a new one and the `add` methods append to the last one
+     */
+    template <MeshData Mesh>
+    class CavitySet {
+        private:
+            using FaceIndex = typename Mesh::FaceIndex;
+            using EdgeIndex = typename Mesh::EdgeIndex;
+            /**
+             * Start of the lists of a cavity in each array
+             */
+            struct Offsets {
+                size_t allTriangles;
+                size_t interior;
+                size_t boundaryTriangles;
+                size_t boundaryEdges;
+            };
+            std::vector<Offsets> offsets;
             std::vector<FaceIndex> allTriangles;
             std::vector<FaceIndex> interior;
             std::vector<FaceIndex> boundaryTriangles;
             std::vector<EdgeIndex> boundaryEdges;
+
+            /**
+             * @return The offsets one past the end of cavity `i`
+             */
+            Offsets end(size_t i) const {
+                if (i + 1 < offsets.size()) {
+                    return offsets[i + 1];
+                }
+                return Offsets{allTriangles.size(), interior.size(), boundaryTriangles.size(), boundaryEdges.size()};
+            }
+        public:
+            using value_type = Cavity<Mesh>;
+
+            size_t size() const {
+                return offsets.size();
+            }
+
+            bool empty() const {
+                return offsets.empty();
+            }
+
+            /**
+             * Starts a new empty cavity, the following `add` calls append to it
+             */
+            void emplace_back() {
+                offsets.push_back(Offsets{allTriangles.size(), interior.size(), boundaryTriangles.size(), boundaryEdges.size()});
+            }
+
+            void addTriangle(FaceIndex triangle) {
+                allTriangles.push_back(triangle);
+            }
+
+            void addInterior(FaceIndex triangle) {
+                interior.push_back(triangle);
+            }
+
+            void addBoundaryTriangle(FaceIndex triangle) {
+                boundaryTriangles.push_back(triangle);
+            }
+
+            void addBoundaryEdge(EdgeIndex edge) {
+                boundaryEdges.push_back(edge);
+            }
+
+            /**
+             * @return A view of cavity `i`
+             */
+            Cavity<Mesh> operator[](size_t i) const {
+                const Offsets& begin = offsets[i];
+                Offsets last = end(i);
+                return Cavity<Mesh>{
+                    std::span<const FaceIndex>(allTriangles.data() + begin.allTriangles, last.allTriangles - begin.allTriangles),
+                    std::span<const FaceIndex>(interior.data() + begin.interior, last.interior - begin.interior),
+                    std::span<const FaceIndex>(boundaryTriangles.data() + begin.boundaryTriangles, last.boundaryTriangles - begin.boundaryTriangles),
+                    std::span<const EdgeIndex>(boundaryEdges.data() + begin.boundaryEdges, last.boundaryEdges - begin.boundaryEdges)
+                };
+            }
+
+            /**
+             * @return A view of the last cavity, the one being built while computing cavities
+             */
+            Cavity<Mesh> back() const {
+                return (*this)[offsets.size() - 1];
+            }
+
+            size_t memoryUsage() const {
+                return sizeof(Offsets) * offsets.capacity()
+                    + sizeof(FaceIndex) * (allTriangles.capacity() + interior.capacity() + boundaryTriangles.capacity())
+                    + sizeof(EdgeIndex) * boundaryEdges.capacity();
+            }
     };
 }
 
@@ -0,0 +1,168 @@
+#ifndef CIRCUMCIRCLE_TABLE_HPP
+#define CIRCUMCIRCLE_TABLE_HPP
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <concepts/mesh_data.hpp>
+#include <mesh_data/structures/vertex.hpp>
+#include <misc/incircle_batch.hpp>
+#include <misc/parallel.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CIRCUMCIRCLE_TABLE_X86
+#include <immintrin.h>
+#endif
+
+namespace generators::helpers::delaunay_cavity {
+    /**
+     * Circumcircle of every triangle of a mesh, center and squared radius stored one array per component.
+     *
+     * With it the cavity search tests a point against a triangle by comparing its squared distance to the center
+     * with the squared radius, only points too close to the circle for that comparison to be trusted go through
+     * `Vertex::inCircle`.
+     */
+    class CircumcircleTable {
+        private:
+            /**
+             * Triangles gathered per block before computing their circumcircles
+             */
+            static constexpr size_t blockSize = 256;
+            /**
+             * Below this absolute value the determinant of a triangle makes it degenerate, same as in `Vertex::findCircumcenter`
+             */
+            static constexpr double degenerateDeterminant = 1e-9;
+
+#ifdef CIRCUMCIRCLE_TABLE_X86
+            /**
+             * Circumcircles of triangles [`begin`, `end`) given their vertices relative to the first one, 4 at a time
+             * @return Where it stopped, the remaining triangles are fewer than a vector
+             */
+            __attribute__((target("avx2")))
+            static size_t computeAvx2(size_t begin, size_t end, const double* bx, const double* by, const double* cx, const double* cy, double* centerX, double* centerY, double* radius2, double* determinant) {
+                const __m256d two = _mm256_set1_pd(2.0);
+                size_t i = begin;
+                for (; i + 4 <= end; i += 4) {
+                    __m256d bX = _mm256_loadu_pd(bx + i), bY = _mm256_loadu_pd(by + i);
+                    __m256d cX = _mm256_loadu_pd(cx + i), cY = _mm256_loadu_pd(cy + i);
+                    __m256d det = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(bX, cY), _mm256_mul_pd(bY, cX)));
+                    __m256d bLength2 = _mm256_add_pd(_mm256_mul_pd(bX, bX), _mm256_mul_pd(bY, bY));
+                    __m256d cLength2 = _mm256_add_pd(_mm256_mul_pd(cX, cX), _mm256_mul_pd(cY, cY));
+                    __m256d x = _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(cY, bLength2), _mm256_mul_pd(bY, cLength2)), det);
+                    __m256d y = _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(bX, cLength2), _mm256_mul_pd(cX, bLength2)), det);
+                    _mm256_storeu_pd(centerX + i, x);
+                    _mm256_storeu_pd(centerY + i, y);
+                    _mm256_storeu_pd(radius2 + i, _mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)));
+                    _mm256_storeu_pd(determinant + i, det);
+                }
+                return i;
+            }
+#endif
+            /**
+             * Same as `computeAvx2`, one triangle at a time
+             */
+            static void computeScalar(size_t begin, size_t end, const double* bx, const double* by, const double* cx, const double* cy, double* centerX, double* centerY, double* radius2, double* determinant) {
+                for (size_t i = begin; i < end; ++i) {
+                    double det = 2 * (bx[i] * cy[i] - by[i] * cx[i]);
+                    double bLength2 = bx[i] * bx[i] + by[i] * by[i];
+                    double cLength2 = cx[i] * cx[i] + cy[i] * cy[i];
+                    centerX[i] = (cy[i] * bLength2 - by[i] * cLength2) / det;
+                    centerY[i] = (bx[i] * cLength2 - cx[i] * bLength2) / det;
+                    radius2[i] = centerX[i] * centerX[i] + centerY[i] * centerY[i];
+                    determinant[i] = det;
+                }
+            }
+        public:
+            /**
+             * Relative margin around the squared radius inside which the distance comparison defers to `Vertex::inCircle`
+             */
+            static constexpr double tolerance = 1e-6;
+
+            std::vector<double> centerX;
+            std::vector<double> centerY;
+            std::vector<double> radius2;
+            /**
+             * Whether the triangle is degenerate, its circumcircle entries are meaningless then
+             */
+            std::vector<uint8_t> degenerate;
+
+            /**
+             * Fills the table with the circumcircles of every triangle of `mesh`, in parallel
+             */
+            template <MeshData Mesh>
+            void compute(const Mesh* mesh) {
+                size_t nTriangles = mesh->numberOfPolygons();
+                centerX.resize(nTriangles);
+                centerY.resize(nTriangles);
+                radius2.resize(nTriangles);
+                degenerate.resize(nTriangles);
+                parallel::forEachChunk(0, nTriangles, [&](size_t, size_t chunkBegin, size_t chunkEnd) {
+                    std::vector<double> ax(blockSize), ay(blockSize), bx(blockSize), by(blockSize), cx(blockSize), cy(blockSize), determinant(blockSize);
+                    for (size_t blockBegin = chunkBegin; blockBegin < chunkEnd; blockBegin += blockSize) {
+                        size_t count = std::min(blockSize, chunkEnd - blockBegin);
+                        for (size_t i = 0; i < count; ++i) {
+                            Vertex v0, v1, v2;
+                            mesh->getVerticesOfTriangle(blockBegin + i, v0, v1, v2);
+                            ax[i] = v0.x;
+                            ay[i] = v0.y;
+                            bx[i] = v1.x - v0.x;
+                            by[i] = v1.y - v0.y;
+                            cx[i] = v2.x - v0.x;
+                            cy[i] = v2.y - v0.y;
+                        }
+                        double* x = centerX.data() + blockBegin;
+                        double* y = centerY.data() + blockBegin;
+                        double* r2 = radius2.data() + blockBegin;
+                        size_t computed = 0;
+#ifdef CIRCUMCIRCLE_TABLE_X86
+                        if (incircle_batch::kernel() != incircle_batch::Kernel::SCALAR) {
+                            computed = computeAvx2(0, count, bx.data(), by.data(), cx.data(), cy.data(), x, y, r2, determinant.data());
+                        }
+#endif
+                        computeScalar(computed, count, bx.data(), by.data(), cx.data(), cy.data(), x, y, r2, determinant.data());
+                        for (size_t i = 0; i < count; ++i) {
+                            x[i] += ax[i];
+                            y[i] += ay[i];
+                            degenerate[blockBegin + i] = std::fabs(determinant[i]) < degenerateDeterminant;
+                        }
+                    }
+                });
+            }
+
+            /**
+             * @return The circumcenter of `triangle`
+             */
+            Vertex center(size_t triangle) const {
+                return Vertex{centerX[triangle], centerY[triangle]};
+            }
+
+            /**
+             * @return `INSIDE` or `OUTSIDE` if `p` is clearly inside or outside the circumcircle of `triangle`, `UNDECIDED` if
+             * it's too close to the circle (or the triangle is degenerate) to tell without an incircle test
+             */
+            uint8_t classify(size_t triangle, const Vertex& p) const {
+                if (degenerate[triangle]) {
+                    return incircle_batch::UNDECIDED;
+                }
+                double dx = p.x - centerX[triangle];
+                double dy = p.y - centerY[triangle];
+                double difference = dx * dx + dy * dy - radius2[triangle];
+                double margin = tolerance * radius2[triangle];
+                if (difference < -margin) {
+                    return incircle_batch::INSIDE;
+                }
+                if (difference > margin) {
+                    return incircle_batch::OUTSIDE;
+                }
+                return incircle_batch::UNDECIDED;
+            }
+
+            size_t memoryUsage() const {
+                return sizeof(double) * (centerX.capacity() + centerY.capacity() + radius2.capacity()) + sizeof(uint8_t) * degenerate.capacity();
+            }
+    };
+}
+
+#undef CIRCUMCIRCLE_TABLE_X86
+#endif
@@ -2,12 +2,20 @@
 #define DELAUNAY_CAVITY_DATA_HPP
 #include <mesh_generators/mesh_generator_data.hpp>
 #include <concepts/mesh_data.hpp>
+#include <type_traits>
 
 template <MeshData Mesh>
 struct DelaunayCavityData : public MeshGeneratorData {
     using OutputIndex = typename Mesh::OutputIndex;
+    /**
+     * Wide enough to number every cavity of the mesh, there are never more cavities than triangles
+     */
+    using CavityStamp = std::make_unsigned_t<typename Mesh::FaceIndex>;
     std::vector<OutputIndex> outputSeeds;
-    std::vector<uint8_t> inCavity;
+    /**
+     * For each triangle, the number (starting at 1) of the last cavity it was added to, or 0 if it isn't in any cavity
+     */
+    std::vector<CavityStamp> inCavity;
 
     inline void removeInvalidSeeds() {
         outputSeeds.erase(std::remove(outputSeeds.begin(), outputSeeds.end(), -1), outputSeeds.end());
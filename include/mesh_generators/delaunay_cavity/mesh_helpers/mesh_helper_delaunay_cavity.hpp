@@ -2,7 +2,9 @@
 #define MESH_HELPER_DELAUNAY_CAVITY_HPP
 #include <concepts/mesh_data.hpp>
 #include <concepts/polygon_merging_policy_concept.hpp>
+#include <misc/edge_length_cache.hpp>
 #include <mesh_generators/delaunay_cavity/helper_structs/union_find_cavity_merger.hpp>
+#include <mesh_generators/delaunay_cavity/helper_structs/delaunay_cavity_data.hpp>
 namespace generators::helpers::delaunay_cavity {
 
     template <MeshData MeshType>
@@ -12,6 +14,7 @@ namespace generators::helpers::delaunay_cavity {
         using VertexIndex = typename MeshType::VertexIndex;
         using OutputIndex = typename MeshType::OutputIndex;
         using _Cavity = Cavity<MeshType>;
+        using _CavitySet = CavitySet<MeshType>;
     };
     /**
      * Helper class to do mesh specific operations on generic generator methods.
@@ -27,6 +30,7 @@ namespace generators::helpers::delaunay_cavity {
         using typename Base::VertexIndex;
         using typename Base::OutputIndex;
         using typename Base::_Cavity;
+        using typename Base::_CavitySet;
         /**
          * @param mesh A particular MeshData implementation
          * @returns A vector of output indices that represent what uniquely identifies a particular polygon in
@@ -42,15 +46,6 @@ namespace generators::helpers::delaunay_cavity {
          */
         static bool isBorderEdge(const MeshType* mesh, EdgeIndex e) = delete;
 
-        /**
-         * @param mesh A particular MeshData implementation
-         * @param edge An edge index that identifes an edge of `mesh`
-         * @param triangle1 A face index that identifies a triangle of `mesh`
-         * @param triangle2 A face index that identifies another triangle of `mesh` different from `triangle1`
-         * @return Whether the edge `edge` is the shared edge between `triangle1` and `triangle2`
-         */
-        static bool isSharedTriangleEdge(const MeshType* mesh, EdgeIndex edge, FaceIndex triangle1, FaceIndex triangle2) = delete;
-
         /**
          * @param mesh A particular MeshData implementation
          * @param triangle A face index that identifies a triangle of `mesh`
@@ -63,10 +58,15 @@ namespace generators::helpers::delaunay_cavity {
          * the changes in the final output
          * @param inputMesh A particular MeshData implementation to traverse the original triangles
          * @param outputMesh A particular MeshData implementation whose contents will be modified
-         * @param cavities A vector of Cavity objects with the necessary information to insert the cavities
+         * @param cavities The cavities with the necessary information to insert the cavities
          * @return A vector of outputs to write
          */
-        static std::vector<OutputIndex> insertCavity(const MeshType* inputMesh, MeshType* outputMesh, std::vector<_Cavity>& cavities, const std::vector<uint8_t>& inCavity) = delete;
+        static std::vector<OutputIndex> insertCavity(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity) = delete;
+
+        /**
+         * Same as `insertCavity` for cavities that don't share triangles, inserting them in parallel with the same result
+         */
+        static std::vector<OutputIndex> insertDisjointCavities(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity) = delete;
 
         /**
          * Builds a union-find struct of the outputs to their representatives
@@ -79,10 +79,11 @@ namespace generators::helpers::delaunay_cavity {
          */
         static OutputIndex changeToValidRepresentative(MeshType* outputMesh, UnionFindCavityMerger<MeshType>& edgeToOutputMap, std::vector<EdgeIndex> invalidEdges, OutputIndex currentRepresentative) = delete;
         /**
-         * Merges the given triangle into one of its neighbors according to some merging policy
+         * Merges the given triangle into one of its neighbors according to some merging policy,
+         * `edgeLengths` is only read by an `EdgeLengthMergingPolicy`
          */
         template <PolygonMergingPolicy<MeshType> MergingPolicy>
-        static void mergeIntoNeighbor(const MeshType* inputMesh, MeshType* outputMesh, std::vector<OutputIndex>& outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<MeshType>& edgeToOutputMap) = delete;
+        static void mergeIntoNeighbor(const MeshType* inputMesh, MeshType* outputMesh, std::vector<OutputIndex>& outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<MeshType>& edgeToOutputMap, const EdgeLengthCache<MeshType>& edgeLengths) = delete;
     };
 
 }
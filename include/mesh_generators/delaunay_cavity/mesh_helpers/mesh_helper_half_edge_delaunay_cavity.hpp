@@ -6,75 +6,93 @@
 #endif
 
 #include <mesh_generators/delaunay_cavity/cavity_merger_strategy/polygon_merging_policy/polygon_merging_policies.hpp>
-#include <mesh_data/half_edge_mesh.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
 #include <mesh_generators/delaunay_cavity/helper_structs/cavity.hpp>
 #include <array>
 #include <vector>
 #include <algorithm>
 #include <ranges>
+#include <numeric>
+#include <utility>
+#include <misc/parallel.hpp>
 namespace generators::helpers::delaunay_cavity {
 
-    template <>
-    struct MeshHelper<HalfEdgeMesh> : MeshHelperBase<HalfEdgeMesh> {
+    template <HalfEdgeMeshData MeshType>
+    struct MeshHelper<MeshType> : MeshHelperBase<MeshType> {
+        using Base = MeshHelperBase<MeshType>;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::VertexIndex;
+        using typename Base::OutputIndex;
+        using typename Base::_Cavity;
+        using typename Base::_CavitySet;
 
         /**
-         * @param mesh A HalfEdgeMesh
+         * @param mesh A half edge based mesh
          * @return A vector of indices to edges where each edge belongs to only one triangle
          */
-        static std::vector<OutputIndex> generateInitialOutputSeeds(HalfEdgeMesh* mesh);
+        static std::vector<OutputIndex> generateInitialOutputSeeds(MeshType* mesh);
 
         /**
-         * @param mesh A HalfEdgeMesh
+         * @param mesh A half edge based mesh
          * @param e An EdgeIndex of `mesh`
          * @return Whether `e` or its twin is a border edge to make sure the half edges at the boundary aren't deleted
          */
-        static bool isBorderEdge(const HalfEdgeMesh* mesh, EdgeIndex e);
+        static bool isBorderEdge(const MeshType* mesh, EdgeIndex e);
 
         /**
-         * @param mesh A HalfEdgeMesh
-         * @param edge An EdgeIndex of `mesh`
-         * @param triangle1 A FaceIndex of `mesh` that identifies a triangle
-         * @param triangle2 A FaceIndex of `mesh` that identifies a triangle different from `triangle1`
-         * @return Whether `e` (or its twin) is the shared edge between `triangle1` and `triangle2`
-         * 
-         * Both are checked because in the generic logic two triangles only share a single edge, so they are considered "equal"
-         */
-        static bool isSharedTriangleEdge(const HalfEdgeMesh* mesh, EdgeIndex edge, FaceIndex triangle1, FaceIndex triangle2);
-
-        /**
-         * @param mesh A HalfEdgeMesh
+         * @param mesh A half edge based mesh
          * @param triangle A FaceIndex of `mesh` that identifies a triangle
          * @return An array of size 3 that contains the CCW interior half edge indices of `triangle`
          */
-        static std::array<EdgeIndex,3> getTriangleEdges(HalfEdgeMesh* mesh, FaceIndex triangle);
+        static std::array<EdgeIndex,3> getTriangleEdges(MeshType* mesh, FaceIndex triangle);
 
         /**
          * Updates the values of `next` and `prev` of the edges present at the cavity's boundary so walking through them
          * results in making the closed loop of each cavity instead of the triangles that conformed it.
          * 
          * The face and edge count of the mesh are also updated to reflect this change
-         * @param inputMesh A HalfEdgeMesh to traverse the triangles
-         * @param outputMesh A HalfEdgeMesh to insert the cavities into
-         * @param cavities A vector of Cavity objects with information to do the cavity insertion
+         * @param inputMesh A half edge based mesh to traverse the triangles
+         * @param outputMesh A half edge based mesh to insert the cavities into
+         * @param cavities The cavities with information to do the cavity insertion
+         */
+        static std::vector<OutputIndex> insertCavity(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity);
+
+        /**
+         * Same as `insertCavity` for cavities that don't share triangles, inserting them in parallel.
+         *
+         * `outputMesh` must allow updating the `next` and `prev` of different edges concurrently. The output seeds are
+         * in the same order `insertCavity` gives
+         */
+        static std::vector<OutputIndex> insertDisjointCavities(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity);
+
+        /**
+         * Links the boundary edges of a cavity of more than one triangle into a single loop in `outputMesh`.
+         *
+         * The boundary edges are sorted by origin and the one leaving each vertex is binary searched, so it takes O(b log b) time
+         * for a boundary of b edges. Boundaries are short enough that this is faster than hashing them
+         * @param presentInBoundary A flag per edge of `inputMesh`, all unset, it's left unset again
+         * @param outgoingEdges A buffer reused across cavities
          */
-        static std::vector<OutputIndex> insertCavity(const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, std::vector<_Cavity>& cavities, const std::vector<uint8_t>& inCavity);
+        static void relinkCavity(const MeshType* inputMesh, MeshType* outputMesh, const _Cavity& cavity, std::vector<uint8_t>& presentInBoundary, std::vector<std::pair<VertexIndex, EdgeIndex>>& outgoingEdges);
 
         /**
          * Builds a hashmap of edges to their representatives
          */
-        static UnionFindCavityMerger<HalfEdgeMesh> buildEdgeToOutputMap(HalfEdgeMesh* outputMesh, const std::vector<OutputIndex>& outputSeeds);
+        static UnionFindCavityMerger<MeshType> buildEdgeToOutputMap(MeshType* outputMesh, const std::vector<OutputIndex>& outputSeeds);
 
         /**
          * Given a vector of "invalid edges" that will be deleted as a result of merging, the edgeToOutputMap is checked to see if these edges were
          * representatives, and if so, change the polygon's representative to a different, valid edge
          */
-        static OutputIndex changeToValidRepresentative(HalfEdgeMesh* outputMesh, UnionFindCavityMerger<HalfEdgeMesh>& edgeToOutputMap, std::vector<EdgeIndex> invalidEdges, OutputIndex currentRepresentative);
+        static OutputIndex changeToValidRepresentative(MeshType* outputMesh, UnionFindCavityMerger<MeshType>& edgeToOutputMap, std::vector<EdgeIndex> invalidEdges, OutputIndex currentRepresentative);
 
         /**
-         * Merges the given triangle into one of its neighbors according to some merging policy
+         * Merges the given triangle into one of its neighbors according to some merging policy,
+         * `edgeLengths` is only read by an `EdgeLengthMergingPolicy`
          */
-        template <PolygonMergingPolicy<HalfEdgeMesh> MergingPolicy>
-        static void mergeIntoNeighbor(const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, std::vector<OutputIndex>& outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<HalfEdgeMesh>& edgeToOutputMap);
+        template <PolygonMergingPolicy<MeshType> MergingPolicy>
+        static void mergeIntoNeighbor(const MeshType* inputMesh, MeshType* outputMesh, std::vector<OutputIndex>& outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<MeshType>& edgeToOutputMap, const EdgeLengthCache<MeshType>& edgeLengths);
     };
 }
 
@@ -4,38 +4,52 @@
 #include <cmath>
 #include <algorithm>
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 
 template <MeshData Mesh, bool ByAscendingOrder, bool ByMinAngle = true>
 struct AngleComparator {
-    using MeshVertex = typename Mesh::VertexType;
     using FaceIndex = typename Mesh::FaceIndex;
-    static bool compare(const Mesh* meshptr, const FaceIndex& t1, const FaceIndex& t2) {
+    static constexpr bool ascending = ByAscendingOrder;
+    static constexpr unsigned int qualityMetrics = ByMinAngle ? Q_MIN_ANGLE : Q_MAX_ANGLE;
+    /**
+     * @return The smallest (or biggest) interior angle of `polygonIndex`, in radians
+     */
+    static double key(const Mesh* meshptr, const FaceIndex& polygonIndex) {
+        Vertex v1;
+        Vertex v2;
+        Vertex v3;
+        meshptr->getVerticesOfTriangle(polygonIndex,v1,v2,v3);
+        Vertex edgeV1V2 = v2 - v1;
+        Vertex edgeV2V3 = v3 - v2;
+        Vertex edgeV3V1 = v1 - v3;
         
-        auto getAngle = [&](const FaceIndex polygonIndex) {
-            MeshVertex v1;
-            MeshVertex v2;
-            MeshVertex v3;
-            meshptr->getVerticesOfTriangle(polygonIndex,v1,v2,v3);
-            Vertex edgeV1V2 = v2 - v1;
-            Vertex edgeV2V3 = v3 - v2;
-            Vertex edgeV3V1 = v1 - v3;
-            
-            // Equality of dot product: cos theta = (A . B) / (||A|| * ||B||)
-            // So we take the arc cosine of that
-            double angle1 = std::acos(std::clamp((edgeV3V1.dot(edgeV1V2)) / (std::sqrt(edgeV3V1.dot(edgeV3V1)) * std::sqrt(edgeV1V2.dot(edgeV1V2))), -1.0, 1.0));
-            double angle2 = std::acos(std::clamp((-edgeV1V2.dot(edgeV2V3)) / (std::sqrt(edgeV1V2.dot(edgeV1V2)) * std::sqrt(edgeV2V3.dot(edgeV2V3))), -1.0, 1.0));
-            double angle3 = std::acos(std::clamp((-edgeV2V3.dot(edgeV3V1)) / (std::sqrt(edgeV2V3.dot(edgeV2V3)) * std::sqrt(edgeV3V1.dot(edgeV3V1))), -1.0, 1.0));
+        // Equality of dot product: cos theta = (A . B) / (||A|| * ||B||)
+        // So we take the arc cosine of that
+        double angle1 = std::acos(std::clamp((edgeV3V1.dot(edgeV1V2)) / (std::sqrt(edgeV3V1.dot(edgeV3V1)) * std::sqrt(edgeV1V2.dot(edgeV1V2))), -1.0, 1.0));
+        double angle2 = std::acos(std::clamp((-edgeV1V2.dot(edgeV2V3)) / (std::sqrt(edgeV1V2.dot(edgeV1V2)) * std::sqrt(edgeV2V3.dot(edgeV2V3))), -1.0, 1.0));
+        double angle3 = std::acos(std::clamp((-edgeV2V3.dot(edgeV3V1)) / (std::sqrt(edgeV2V3.dot(edgeV2V3)) * std::sqrt(edgeV3V1.dot(edgeV3V1))), -1.0, 1.0));
 
-            if constexpr (ByMinAngle) {
-                return std::min({angle1, angle2, angle3});
-            } else {
-                return std::max({angle1, angle2, angle3});
-            }
-        };
+        if constexpr (ByMinAngle) {
+            return std::min({angle1, angle2, angle3});
+        } else {
+            return std::max({angle1, angle2, angle3});
+        }
+    }
+    /**
+     * Same as `key`, read from `cache`
+     */
+    static double key(const TriangleQualityCache& cache, const FaceIndex& polygonIndex) {
+        if constexpr (ByMinAngle) {
+            return cache.minAngle[polygonIndex];
+        } else {
+            return cache.maxAngle[polygonIndex];
+        }
+    }
+    static bool compare(const Mesh* meshptr, const FaceIndex& t1, const FaceIndex& t2) {
         if constexpr (ByAscendingOrder) {
-            return getAngle(t1) < getAngle(t2);
+            return key(meshptr, t1) < key(meshptr, t2);
         } else {
-            return getAngle(t1) > getAngle(t2);
+            return key(meshptr, t1) > key(meshptr, t2);
         }
     }
 };
@@ -2,29 +2,41 @@
 #define AREA_COMPARATOR_HPP
 #include <concepts/selection_criterion.hpp>
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 #include <cmath>
 
 template <MeshData Mesh, bool ByAscendingOrder, bool Precise = false>
 struct AreaComparator {
-    using MeshVertex = typename Mesh::VertexType;
     using FaceIndex = typename Mesh::FaceIndex;
-    static bool compare(const Mesh* meshptr, const FaceIndex& t1, const FaceIndex& t2) {
-        MeshVertex v0t1, v1t1, v2t1;
-        MeshVertex v0t2, v1t2, v2t2;
-
-        meshptr->getVerticesOfTriangle(t1, v0t1, v1t1, v2t1);
-        meshptr->getVerticesOfTriangle(t2, v0t2, v1t2, v2t2);
-
-        double area1 = v0t1.cross2d(v1t1,v2t1);
-        double area2 = v0t2.cross2d(v1t2,v2t2);
+    static constexpr bool ascending = ByAscendingOrder;
+    static constexpr unsigned int qualityMetrics = Q_AREA2;
+    /**
+     * @return The absolute area of `polygonIndex`, or twice that unless `Precise`
+     */
+    static double key(const Mesh* meshptr, const FaceIndex& polygonIndex) {
+        Vertex v0, v1, v2;
+        meshptr->getVerticesOfTriangle(polygonIndex, v0, v1, v2);
+        double area = v0.cross2d(v1,v2);
+        if constexpr (Precise) {
+            area *= 0.5;
+        }
+        return std::fabs(area);
+    }
+    /**
+     * Same as `key`, read from `cache`
+     */
+    static double key(const TriangleQualityCache& cache, const FaceIndex& polygonIndex) {
+        double area = cache.area2[polygonIndex];
         if constexpr (Precise) {
-            area1 *= 0.5;
-            area2 *= 0.5;
+            area *= 0.5;
         }
+        return std::fabs(area);
+    }
+    static bool compare(const Mesh* meshptr, const FaceIndex& t1, const FaceIndex& t2) {
         if constexpr (ByAscendingOrder) {
-            return std::fabs(area1) < std::fabs(area2);
+            return key(meshptr, t1) < key(meshptr, t2);
         } else {
-            return std::fabs(area1) > std::fabs(area2);
+            return key(meshptr, t1) > key(meshptr, t2);
         }
     }
 };
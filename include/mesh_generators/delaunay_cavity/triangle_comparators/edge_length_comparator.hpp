@@ -1,28 +1,45 @@
 #ifndef EDGE_LENGTH_COMPARATOR_HPP
 #define EDGE_LENGTH_COMPARATOR_HPP
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 #include <array>
 #include <algorithm>
+#include <numeric>
+#include <limits>
 
 template <MeshData Mesh, bool ByAscendingOrder, bool ByMinEdge = true>
 struct EdgeLengthComparator {
     using FaceIndex = typename Mesh::FaceIndex;
     using EdgeIndex = typename Mesh::EdgeIndex;
+    static constexpr bool ascending = ByAscendingOrder;
+    static constexpr unsigned int qualityMetrics = ByMinEdge ? Q_MIN_EDGE_LENGTH2 : Q_MAX_EDGE_LENGTH2;
+    /**
+     * @return The squared length of the shortest (or longest) edge of `polygonIndex`
+     */
+    static double key(const Mesh* meshptr, const FaceIndex& polygonIndex) {
+        std::array<EdgeIndex, 3> edges = meshptr->getEdgesOfTriangle(polygonIndex);
+        return std::transform_reduce(
+            edges.begin(), edges.end(),
+            ByMinEdge ? std::numeric_limits<double>::max()
+                      : std::numeric_limits<double>::lowest(),
+            ByMinEdge ? [](double a, double b){ return std::min(a, b); }
+                      : [](double a, double b){ return std::max(a, b); },
+            [meshptr](EdgeIndex e){ return meshptr->edgeLength2(e); }
+        );
+    }
+    /**
+     * Same as `key`, read from `cache`
+     */
+    static double key(const TriangleQualityCache& cache, const FaceIndex& polygonIndex) {
+        if constexpr (ByMinEdge) {
+            return cache.minEdgeLength2[polygonIndex];
+        } else {
+            return cache.maxEdgeLength2[polygonIndex];
+        }
+    }
     static bool compare(const Mesh* meshptr, const FaceIndex& t1, const FaceIndex& t2) {
-
-        auto selectEdge = [meshptr](const std::array<EdgeIndex, 3>& edges) {
-            return std::transform_reduce(
-                edges.begin(), edges.end(),
-                ByMinEdge ? std::numeric_limits<double>::max()
-                          : std::numeric_limits<double>::lowest(),
-                ByMinEdge ? [](double a, double b){ return std::min(a, b); }
-                          : [](double a, double b){ return std::max(a, b); },
-                [meshptr](EdgeIndex e){ return meshptr->edgeLength2(e); }
-            );
-        };
-
-        double selectedT1Edge = selectEdge(meshptr->getEdgesOfTriangle(t1));
-        double selectedT2Edge = selectEdge(meshptr->getEdgesOfTriangle(t2));
+        double selectedT1Edge = key(meshptr, t1);
+        double selectedT2Edge = key(meshptr, t2);
 
         if constexpr (ByAscendingOrder) {
             return selectedT1Edge < selectedT2Edge;
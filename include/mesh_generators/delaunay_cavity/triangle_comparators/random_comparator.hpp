@@ -1,19 +1,37 @@
 #ifndef RANDOM_COMPARATOR_HPP
 #define RANDOM_COMPARATOR_HPP
 #include <concepts/mesh_data.hpp>
+#include <misc/philox.hpp>
+#include <cstdint>
 #include <random>
 
+/**
+ * Orders the triangles randomly, by random bits drawn for each triangle from a counter based generator keyed by the seed.
+ *
+ * The bits of a triangle only depend on the seed and its index, so the order is the same for a given seed whatever
+ * the number of threads sorting. Each comparator holds its own seed, so generators running at the same time don't share it
+ */
 template <MeshData Mesh>
-struct RandomComparator {
-    using FaceIndex = typename Mesh::FaceIndex;
-    inline static std::random_device rd;
-    inline static std::mt19937 generator{rd()};
-    static void setSeed(unsigned int seed) {
-        generator = std::mt19937{seed};
-    }
+class RandomComparator {
+    public:
+        using FaceIndex = typename Mesh::FaceIndex;
+    private:
+        std::uint64_t seed;
+    public:
+        /**
+         * Seeds the comparator from `std::random_device`
+         */
+        RandomComparator() : seed(std::random_device{}()) {}
+        explicit RandomComparator(std::uint64_t seed) : seed(seed) {}
+        /**
+         * @return The random bits `triangle` is sorted by
+         */
+        std::uint64_t randomBits(FaceIndex triangle) const {
+            return philox::bits(seed, triangle);
+        }
 };
 
 template<MeshData Mesh>
 inline constexpr bool isRandomComparator<RandomComparator<Mesh>,Mesh> = true;
 
-#endif // RANDOM_COMPARATOR_HPP
\ No newline at end of file
+#endif // RANDOM_COMPARATOR_HPP
@@ -4,36 +4,47 @@
 #include <mesh_generators/polylla/mesh_helpers/mesh_helper_polylla.hpp>
 #endif
 
-#include <mesh_data/half_edge_mesh.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <misc/edge_length_cache.hpp>
+#include <misc/parallel.hpp>
 
 namespace generators::helpers::polylla {
 
-    template <>
-    struct MeshHelper<HalfEdgeMesh> : MeshHelperBase<HalfEdgeMesh> {
+    template <HalfEdgeMeshData MeshType>
+    struct MeshHelper<MeshType> : MeshHelperBase<MeshType> {
+        using Base = MeshHelperBase<MeshType>;
+        using typename Base::VertexIndex;
+        using typename Base::EdgeIndex;
+        using typename Base::FaceIndex;
+        using typename Base::OutputIndex;
+        using typename Base::GeneratorData;
         // TODO: add docs
-        static void labelMaxEdges(GeneratorData& data, HalfEdgeMesh* mesh);
+        static void labelMaxEdges(GeneratorData& data, MeshType* mesh);
 
-        static EdgeIndex findMaxEdge(HalfEdgeMesh* mesh, FaceIndex face);
+        /**
+         * @return The longest edge of triangle `face`, reading the edge lengths from `edgeLengths`
+         */
+        static EdgeIndex findMaxEdge(MeshType* mesh, const EdgeLengthCache<MeshType>& edgeLengths, FaceIndex face);
 
-        static void labelFrontierEdges(GeneratorData& data, HalfEdgeMesh* mesh);
+        static void labelFrontierEdges(GeneratorData& data, MeshType* mesh);
 
-        static bool isFrontierEdge(GeneratorData& data, HalfEdgeMesh* mesh, EdgeIndex edge);
+        static bool isFrontierEdge(GeneratorData& data, MeshType* mesh, EdgeIndex edge);
 
-        static std::vector<OutputIndex> generateSeedCandidates(GeneratorData& data, HalfEdgeMesh* mesh);
+        static std::vector<OutputIndex> generateSeedCandidates(GeneratorData& data, MeshType* mesh);
 
-        static bool isSeedCandidateIndex(GeneratorData& data, HalfEdgeMesh* mesh, OutputIndex seedCandidate);
+        static bool isSeedCandidateIndex(GeneratorData& data, MeshType* mesh, OutputIndex seedCandidate);
 
-        static std::vector<OutputIndex> generateOutputSeeds(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh);
+        static std::vector<OutputIndex> generateOutputSeeds(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh);
 
-        static OutputIndex generatePolygonFromSeed(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex seed);
+        static OutputIndex generatePolygonFromSeed(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex seed);
 
-        static EdgeIndex getNextFrontierEdge(GeneratorData& data, const HalfEdgeMesh* mesh, EdgeIndex edge);
+        static EdgeIndex getNextFrontierEdge(GeneratorData& data, const MeshType* mesh, EdgeIndex edge);
 
-        static void barrierEdgeTipReparation(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex nonSimpleSeed, std::vector<OutputIndex>& currentOutputs);
+        static void barrierEdgeTipReparation(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex nonSimpleSeed, std::vector<OutputIndex>& currentOutputs);
 
-        static EdgeIndex calculateMiddleEdge(GeneratorData& data, const HalfEdgeMesh* inputMesh, VertexIndex barrierEdgeTipVertex);
+        static EdgeIndex calculateMiddleEdge(GeneratorData& data, const MeshType* inputMesh, VertexIndex barrierEdgeTipVertex);
 
-        static OutputIndex generateRepairedPolygon(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex seedToRepair);
+        static OutputIndex generateRepairedPolygon(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex seedToRepair);
     };
 }
 
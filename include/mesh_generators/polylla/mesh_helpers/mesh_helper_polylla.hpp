@@ -31,8 +31,6 @@ namespace generators::helpers::polylla {
         // TODO: add docs
         static void labelMaxEdges(GeneratorData& data, MeshType* mesh) = delete;
 
-        static EdgeIndex findMaxEdge(MeshType* mesh, FaceIndex face) = delete;
-
         static void labelFrontierEdges(GeneratorData& data, MeshType* mesh) = delete;
 
         static bool isFrontierEdge(GeneratorData& data, MeshType* mesh, EdgeIndex edge) = delete;
@@ -7,11 +7,17 @@ template <MeshData Mesh, SelectionCriterion<Mesh> Criterion1, SelectionCriterion
 struct OrCriteria {
     Criterion1 criterion1;
     Criterion2 criterion2;
+    static constexpr unsigned int qualityMetrics = criterionQualityMetrics<Criterion1,Mesh> | criterionQualityMetrics<Criterion2,Mesh>;
 
     bool operator()(Mesh& mesh, int polygonIndex) const {
         return criterion1(mesh, polygonIndex) || criterion2(mesh, polygonIndex);
     }
 
+    bool operator()(const TriangleQualityCache& cache, typename Mesh::FaceIndex polygonIndex) const
+    requires CachedSelectionCriterion<Criterion1,Mesh> && CachedSelectionCriterion<Criterion2,Mesh> {
+        return criterion1(cache, polygonIndex) || criterion2(cache, polygonIndex);
+    }
+
     OrCriteria(Criterion1 c1, Criterion2 c2) : criterion1(c1), criterion2(c2) {}
 };
 
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <concepts/mesh_data.hpp>
 #include <mesh_data/structures/vertex.hpp>
+#include <misc/triangle_quality_cache.hpp>
 #include <iostream>
 #define PI 3.14159265358979323846
 
@@ -16,6 +17,7 @@ template <MeshData Mesh>
 struct MinAngleCriterion {
     using FaceIndex = typename Mesh::FaceIndex;
     double angleThreshold;
+    static constexpr unsigned int qualityMetrics = Q_MIN_ANGLE_COS2;
     /**
      * Checks if the minimum angle of the triangle given by `polygonIndex` in `mesh` 
      * is less than or equal to `angleThreshold`, and if so, must be the start of a cavity
@@ -23,6 +25,10 @@ struct MinAngleCriterion {
      * @param polygonIndex The index of the triangle to be checked
      */
     bool operator()(const Mesh* mesh, FaceIndex polygonIndex) const;
+    /**
+     * Same as the other overload, reading the metrics of `polygonIndex` from `cache`
+     */
+    bool operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const;
     /**
      * @param angle Angle threshold the user wants to check for
      * @param type Whether the angle is given in degrees (default to true) or radians
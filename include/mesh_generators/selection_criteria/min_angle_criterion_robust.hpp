@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <concepts/mesh_data.hpp>
 #include <mesh_data/structures/vertex.hpp>
+#include <misc/triangle_quality_cache.hpp>
 #include <concepts/is_half_edge_vertex.hpp>
 #define PI 3.14159265358979323846
 
@@ -15,6 +16,7 @@ template <MeshData Mesh>
 struct MinAngleCriterionRobust {
     using FaceIndex = typename Mesh::FaceIndex;
     double angleThreshold;
+    static constexpr unsigned int qualityMetrics = Q_MIN_ANGLE;
     /**
      * Checks if the minimum angle of the triangle given by `polygonIndex` in `mesh` 
      * is less than or equal to `angleThreshold`, and if so, must be the start of a cavity
@@ -22,6 +24,10 @@ struct MinAngleCriterionRobust {
      * @param polygonIndex The index of the triangle to be checked
      */
     bool operator()(const Mesh* mesh, FaceIndex polygonIndex) const;
+    /**
+     * Same as the other overload, reading the metrics of `polygonIndex` from `cache`
+     */
+    bool operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const;
     /**
      * @param angle Angle threshold the user wants to check for
      * @param type Whether the angle is given in degrees (default to true) or radians
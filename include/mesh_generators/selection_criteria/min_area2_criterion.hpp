@@ -1,15 +1,21 @@
 #ifndef MIN_AREA2_CRITERION_HPP
 #define MIN_AREA2_CRITERION_HPP
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 
 template <MeshData Mesh>
 struct MinArea2Criterion {
     using FaceIndex = typename Mesh::FaceIndex;
     double minArea2;
+    static constexpr unsigned int qualityMetrics = Q_AREA2;
     
     MinArea2Criterion(double minArea2) : minArea2(minArea2) {}
 
     bool operator()(const Mesh* mesh, FaceIndex polygonIndex) const;
+    /**
+     * Same as the other overload, reading the metrics of `polygonIndex` from `cache`
+     */
+    bool operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const;
 };
 
 #include <mesh_generators/selection_criteria/min_area2_criterion.ipp>
@@ -1,13 +1,19 @@
 #ifndef MIN_AREA_CRITERION_HPP
 #define MIN_AREA_CRITERION_HPP
 #include <concepts/mesh_data.hpp>
+#include <misc/triangle_quality_cache.hpp>
 
 template <MeshData Mesh>
 struct MinAreaCriterion {
     using FaceIndex = typename Mesh::FaceIndex;
     double minArea;
+    static constexpr unsigned int qualityMetrics = Q_AREA2;
 
     bool operator()(const Mesh* mesh, FaceIndex polygonIndex) const;
+    /**
+     * Same as the other overload, reading the metrics of `polygonIndex` from `cache`
+     */
+    bool operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const;
 
     MinAreaCriterion(double minArea) : minArea(minArea) {}
 };
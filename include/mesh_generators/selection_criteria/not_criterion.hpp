@@ -10,10 +10,14 @@ template<MeshData Mesh, SelectionCriterion<Mesh> Criterion>
 struct NotCriterion {
     using FaceIndex = typename Mesh::FaceIndex;
     Criterion negatedCriteria;
+    static constexpr unsigned int qualityMetrics = criterionQualityMetrics<Criterion,Mesh>;
     NotCriterion(Criterion criterion) : negatedCriteria(criterion) {}
     bool operator()(const Mesh* mesh, FaceIndex polygonIndex) {
         return !negatedCriteria(mesh,polygonIndex);
     }
+    bool operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const requires CachedSelectionCriterion<Criterion,Mesh> {
+        return !negatedCriteria(cache,polygonIndex);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 #ifndef ALE_WRITER_HPP
 #define ALE_WRITER_HPP
 #include <mesh_io/mesh_writer.hpp>
-#include <mesh_data/half_edge_mesh.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
 
 template <MeshData Mesh>
 class AleWriter : public MeshWriter<Mesh> {
     private:
-        void writeOutputSeeds(std::ofstream& file, HalfEdgeMesh& mesh, std::vector<HalfEdgeMesh::OutputIndex> outputSeeds) requires std::same_as<Mesh, HalfEdgeMesh>;
+        void writeOutputSeeds(std::ofstream& file, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds) requires HalfEdgeMeshData<Mesh>;
     public:
         void writeMesh(const std::vector<std::filesystem::path>& files, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds = {}) override;
 };
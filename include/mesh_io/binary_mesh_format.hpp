@@ -0,0 +1,101 @@
+#ifndef BINARY_MESH_FORMAT_HPP
+#define BINARY_MESH_FORMAT_HPP
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+#include <mesh_data/structures/half_edge.hpp>
+#include <mesh_data/structures/he_vertex.hpp>
+
+/**
+ * Layout of `.hemesh` files, a dump of the arrays of a half edge mesh that can be loaded without parsing
+ * or reconstructing twins.
+ *
+ * The file starts with a `BinaryMeshHeader` followed by these arrays, in this order and each one starting at
+ * a multiple of `binaryMeshAlignment`:
+ * - `vertexRecords` records of type `BasicHEVertex<Index, Scalar>`
+ * - `halfEdgeRecords` records of type `BasicHalfEdge<Index>`
+ * - `polygonRecords` indices, the identifying edge of each face
+ * - `originalVertexIdRecords` indices, the original id of each vertex if the mesh was renumbered when read, or none
+ * - `outputSeedRecords` indices, the edges identifying each output polygon when written after generating a mesh, or none
+ *
+ * Records are written with the native layout and byte order, the header stores their sizes so a file written by
+ * an incompatible build is rejected instead of misread.
+ */
+namespace binary_mesh_format {
+    inline constexpr char magic[8] = {'H', 'E', 'M', 'E', 'S', 'H', '\0', '\0'};
+    inline constexpr std::uint32_t version = 1;
+    inline constexpr size_t alignment = 8;
+    inline constexpr const char* extension = ".hemesh";
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t indexBytes;
+        std::uint32_t vertexRecordBytes;
+        std::uint32_t halfEdgeRecordBytes;
+        std::uint64_t nVertices;
+        std::uint64_t nHalfEdges;
+        std::uint64_t nPolygons;
+        std::uint64_t vertexRecords;
+        std::uint64_t halfEdgeRecords;
+        std::uint64_t polygonRecords;
+        std::uint64_t originalVertexIdRecords;
+        std::uint64_t outputSeedRecords;
+    };
+
+    inline size_t alignedSize(size_t bytes) {
+        return (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    /**
+     * @return A header for meshes indexed with `Index` with `Scalar` coordinates, with every count still set to 0
+     */
+    template <typename Index, typename Scalar = DefaultVertexScalar>
+    Header makeHeader() {
+        Header header{};
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.indexBytes = sizeof(Index);
+        header.vertexRecordBytes = sizeof(BasicHEVertex<Index, Scalar>);
+        header.halfEdgeRecordBytes = sizeof(BasicHalfEdge<Index>);
+        return header;
+    }
+
+    /**
+     * Reads only the header of `filepath`, the caller checks it
+     */
+    inline Header readHeader(const std::filesystem::path& filepath) {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("File: " + filepath.string() + " cannot be opened (does it exist?)");
+        }
+        Header header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header))) {
+            throw std::runtime_error("File: " + filepath.string() + " is too short to be a binary half edge mesh");
+        }
+        return header;
+    }
+
+    /**
+     * Checks that `header` describes a file of this version written with records of `Index` and `Scalar`
+     */
+    template <typename Index, typename Scalar = DefaultVertexScalar>
+    void validateHeader(const Header& header, const std::filesystem::path& filepath) {
+        Header expected = makeHeader<Index, Scalar>();
+        if (std::memcmp(header.magic, expected.magic, sizeof(magic)) != 0) {
+            throw std::runtime_error("File: " + filepath.string() + " is not a binary half edge mesh");
+        }
+        if (header.version != expected.version) {
+            throw std::runtime_error("File: " + filepath.string() + " has binary mesh version " + std::to_string(header.version) + ", expected " + std::to_string(expected.version));
+        }
+        if (header.indexBytes != expected.indexBytes || header.vertexRecordBytes != expected.vertexRecordBytes || header.halfEdgeRecordBytes != expected.halfEdgeRecordBytes) {
+            throw std::runtime_error("File: " + filepath.string() + " was written with " + std::to_string(header.indexBytes * 8) + " bit indices, different coordinate precision or a different record layout than this mesh type uses");
+        }
+    }
+}
+
+#endif
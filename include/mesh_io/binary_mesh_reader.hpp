@@ -0,0 +1,41 @@
+#ifndef BINARY_MESH_READER_HPP
+#define BINARY_MESH_READER_HPP
+#include <cstring>
+#include <atomic>
+#include <concepts>
+#include <mesh_io/mesh_reader.hpp>
+#include <mesh_io/mapped_file.hpp>
+#include <mesh_io/binary_mesh_format.hpp>
+#include <concepts/has_records_constructor.hpp>
+#include <misc/parallel.hpp>
+
+/**
+ * Reads `.hemesh` files written by `BinaryMeshWriter` by memory mapping them.
+ *
+ * Meshes with a records constructor take the arrays as they are, with no parsing nor twin reconstruction, other
+ * meshes are built from the triangles of the file as any other reader would. The vertices of the file are never
+ * renumbered again, renumber them when converting instead.
+ */
+template <MeshData Mesh>
+class BinaryMeshReader : public MeshReader<Mesh> {
+    private:
+        using Index = typename Mesh::EdgeIndex;
+        using Scalar = typename Mesh::VertexType::Scalar;
+        /**
+         * Copies `count` records of type `T` starting at `offset` and moves `offset` past them
+         */
+        template <typename T>
+        static std::vector<T> readArray(const MappedFile& file, size_t& offset, size_t count, const std::filesystem::path& filepath);
+        static binary_mesh_format::Header readHeader(const MappedFile& file, const std::filesystem::path& filepath);
+        /**
+         * Recovers the triangles of the file for meshes that must build their own connectivity
+         */
+        static std::vector<typename Mesh::FaceIndex> trianglesOf(const std::vector<BasicHalfEdge<Index>>& halfEdges, const std::vector<Index>& polygons, size_t nPolygons, const std::filesystem::path& filepath);
+    public:
+        Mesh* readMesh(const std::vector<std::filesystem::path>& files) override;
+        MeshSize readMeshSize(const std::vector<std::filesystem::path>& files) override;
+};
+
+#include <mesh_io/binary_mesh_reader.ipp>
+
+#endif
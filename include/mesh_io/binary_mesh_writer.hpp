@@ -0,0 +1,36 @@
+#ifndef BINARY_MESH_WRITER_HPP
+#define BINARY_MESH_WRITER_HPP
+#include <algorithm>
+#include <concepts>
+#include <mesh_io/mesh_writer.hpp>
+#include <mesh_io/binary_mesh_format.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+
+/**
+ * Writes the half edge structure of a mesh to a `.hemesh` file (see `binary_mesh_format`), so it can be loaded
+ * again by `BinaryMeshReader` without any parsing
+ */
+template <MeshData Mesh>
+class BinaryMeshWriter : public MeshWriter<Mesh> {
+    private:
+        using Index = typename Mesh::EdgeIndex;
+        using Scalar = typename Mesh::VertexType::Scalar;
+        /**
+         * Writes `count` records starting at `data` and pads the file up to the next multiple of `binary_mesh_format::alignment`
+         */
+        template <typename T>
+        static void writeArray(std::ofstream& file, const T* data, size_t count);
+        /**
+         * Writes `count` records of type `T`, assembling each one with `makeRecord(i)` in blocks
+         */
+        template <typename T, typename RecordFunction>
+        static void writeRecords(std::ofstream& file, size_t count, RecordFunction makeRecord);
+        void writeVertices(std::ofstream& file, Mesh& mesh) requires HalfEdgeMeshData<Mesh>;
+        void writeHalfEdges(std::ofstream& file, Mesh& mesh) requires HalfEdgeMeshData<Mesh>;
+    public:
+        void writeMesh(const std::vector<std::filesystem::path>& files, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds = {}) override;
+};
+
+#include <mesh_io/binary_mesh_writer.ipp>
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+#include <cstddef>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Read only view of a whole file, memory mapped where `mmap` is available and read into memory otherwise
+ */
+class MappedFile {
+    private:
+        const std::byte* bytes = nullptr;
+        size_t length = 0;
+        #ifdef _WIN32
+        std::vector<std::byte> buffer;
+        #endif
+    public:
+        explicit MappedFile(const std::filesystem::path& filepath) {
+            #ifndef _WIN32
+            int descriptor = ::open(filepath.c_str(), O_RDONLY);
+            if (descriptor < 0) {
+                throw std::runtime_error("File: " + filepath.string() + " cannot be opened (does it exist?)");
+            }
+            struct stat status;
+            if (::fstat(descriptor, &status) != 0) {
+                ::close(descriptor);
+                throw std::runtime_error("File: " + filepath.string() + " cannot be read");
+            }
+            length = static_cast<size_t>(status.st_size);
+            if (length > 0) {
+                void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (mapping == MAP_FAILED) {
+                    ::close(descriptor);
+                    throw std::runtime_error("File: " + filepath.string() + " cannot be memory mapped");
+                }
+                // The records are read front to back
+                ::madvise(mapping, length, MADV_SEQUENTIAL);
+                bytes = static_cast<const std::byte*>(mapping);
+            }
+            ::close(descriptor);
+            #else
+            std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                throw std::runtime_error("File: " + filepath.string() + " cannot be opened (does it exist?)");
+            }
+            length = static_cast<size_t>(file.tellg());
+            buffer.resize(length);
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(buffer.data()), length);
+            bytes = buffer.data();
+            #endif
+        }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile() {
+            #ifndef _WIN32
+            if (bytes != nullptr) {
+                ::munmap(const_cast<std::byte*>(bytes), length);
+            }
+            #endif
+        }
+        const std::byte* data() const {
+            return bytes;
+        }
+        size_t size() const {
+            return length;
+        }
+};
+
+#endif
@@ -8,13 +8,58 @@
 #include <iostream>
 #include <sstream>
 #include <filesystem>
+#include <mesh_data/spatial_reordering.hpp>
+
+/**
+ * Amount of vertices and triangles of a mesh file, read from its headers only
+ */
+struct MeshSize {
+    size_t nVertices;
+    size_t nTriangles;
+};
 
 template<MeshData Mesh>
 class MeshReader {
     public:
         virtual Mesh* readMesh(const std::vector<std::filesystem::path>& files) = 0;
+        /**
+         * Reads only the headers of `files` so the caller can decide which index width is needed before reading the whole mesh
+         */
+        virtual MeshSize readMeshSize(const std::vector<std::filesystem::path>& files) = 0;
+        /**
+         * When enabled, the vertices and triangles read are renumbered along a Hilbert curve before constructing the mesh,
+         * the mesh keeps the original vertex ids if it can record them
+         */
+        void setSpatialReordering(bool enabled) {
+            spatialReordering = enabled;
+        }
         virtual ~MeshReader() = default;
     protected:
+        bool spatialReordering = false;
+        /**
+         * Renumbers `vertices`, `faces` and `neighbors` along a Hilbert curve if spatial reordering is enabled and `Mesh` can
+         * record the original vertex ids
+         * @return The original index of each vertex, empty if nothing was renumbered
+         */
+        std::vector<typename Mesh::VertexIndex> reorderSpatially(std::vector<typename Mesh::VertexType>& vertices, std::vector<typename Mesh::FaceIndex>& faces, std::vector<typename Mesh::FaceIndex>& neighbors) {
+            if constexpr (requires(Mesh& mesh, std::vector<typename Mesh::VertexIndex> ids) { mesh.setOriginalVertexIds(std::move(ids)); }) {
+                if (spatialReordering) {
+                    return spatial_reordering::reorderAlongHilbertCurve(vertices, faces, neighbors);
+                }
+            }
+            return {};
+        }
+        /**
+         * Hands the ids returned by `reorderSpatially` to `mesh`
+         */
+        static Mesh* withOriginalVertexIds(Mesh* mesh, std::vector<typename Mesh::VertexIndex> originalVertexIds) {
+            if constexpr (requires { mesh->setOriginalVertexIds(std::move(originalVertexIds)); }) {
+                if (!originalVertexIds.empty()) {
+                    mesh->setOriginalVertexIds(std::move(originalVertexIds));
+                }
+            }
+            return mesh;
+        }
         // Esta fue la unica función ql funciono, porque las weas nativas de c++ funcionan mal
         //https://stackoverflow.com/a/22395635
         // Returns false if the string contains any non-whitespace characters
@@ -6,6 +6,8 @@
 #include <iostream>
 #include <sstream>
 #include <filesystem>
+#include <vector>
+#include <concepts>
 
 template<MeshData Mesh>
 class MeshWriter {
@@ -14,7 +16,53 @@ class MeshWriter {
          * Writes files with the appropriate format specified on `files` with the mesh `mesh`
          */
         virtual void writeMesh(const std::vector<std::filesystem::path>& files, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds = {}) = 0;
+        /**
+         * When enabled and the mesh was renumbered when reading it, vertices are written in their original order and
+         * polygons refer to them by their original ids
+         */
+        void setWriteOriginalVertexIds(bool enabled) {
+            writeOriginalVertexIds = enabled;
+        }
         virtual ~MeshWriter() = default;
+    protected:
+        bool writeOriginalVertexIds = false;
+        static constexpr bool canMapVertexIds = requires(const Mesh& mesh, typename Mesh::VertexIndex v) {
+            { mesh.hasOriginalVertexIds() } -> std::convertible_to<bool>;
+            { mesh.originalVertexId(v) } -> std::convertible_to<typename Mesh::VertexIndex>;
+        };
+        /**
+         * @return Whether vertex ids of `mesh` must be mapped back to the ones of the input files
+         */
+        bool mapsVertexIds(const Mesh& mesh) const {
+            if constexpr (canMapVertexIds) {
+                return writeOriginalVertexIds && mesh.hasOriginalVertexIds();
+            } else {
+                return false;
+            }
+        }
+        /**
+         * @return The id written for the vertex `v` of `mesh`
+         */
+        typename Mesh::VertexIndex outputVertexId(const Mesh& mesh, typename Mesh::VertexIndex v) const {
+            if constexpr (canMapVertexIds) {
+                return writeOriginalVertexIds ? mesh.originalVertexId(v) : v;
+            } else {
+                return v;
+            }
+        }
+        /**
+         * @return The vertex of `mesh` written at each position of the vertex list, empty if it's written in its own order
+         */
+        std::vector<typename Mesh::VertexIndex> outputVertexOrder(const Mesh& mesh) const {
+            std::vector<typename Mesh::VertexIndex> order;
+            if (mapsVertexIds(mesh)) {
+                order.resize(mesh.numberOfVertices());
+                for (size_t v = 0; v < order.size(); ++v) {
+                    order[outputVertexId(mesh, v)] = v;
+                }
+            }
+            return order;
+        }
 };
 
 #endif
\ No newline at end of file
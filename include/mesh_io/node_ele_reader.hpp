@@ -13,14 +13,16 @@ class NodeEleReader : public MeshReader<Mesh> {
             return newPath;
         }
         std::vector<std::filesystem::path> parsePaths(const std::vector<std::filesystem::path>& filepaths);
-        unsigned int readNeighFile(const std::filesystem::path& filepaths, std::vector<int>& neighbors);
-        unsigned int readEleFile(const std::filesystem::path& filepaths, std::vector<int>& elements);
-        unsigned int readNodeFile(const std::filesystem::path& filepaths, std::vector<typename Mesh::VertexType>& vertices);
+        size_t readNeighFile(const std::filesystem::path& filepaths, std::vector<typename Mesh::FaceIndex>& neighbors);
+        size_t readEleFile(const std::filesystem::path& filepaths, std::vector<typename Mesh::FaceIndex>& elements);
+        static size_t readHeaderCount(const std::filesystem::path& filepath);
+        size_t readNodeFile(const std::filesystem::path& filepaths, std::vector<typename Mesh::VertexType>& vertices);
     public:
         /**
          * Make sure triangles are 0 indexed
          */
         Mesh* readMesh(const std::vector<std::filesystem::path>& files) override;
+        MeshSize readMeshSize(const std::vector<std::filesystem::path>& files) override;
 };
 
 #include <mesh_io/node_ele_reader.ipp>
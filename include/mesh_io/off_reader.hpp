@@ -7,6 +7,7 @@ template <MeshData Mesh>
 class OffReader : public MeshReader<Mesh> {
     public:
         Mesh* readMesh(const std::vector<std::filesystem::path>& files) override;
+        MeshSize readMeshSize(const std::vector<std::filesystem::path>& files) override;
 };
 
 #include <mesh_io/off_reader.ipp>
@@ -1,12 +1,12 @@
 #ifndef OFF_WRITER_HPP
 #define OFF_WRITER_HPP
 #include<mesh_io/mesh_writer.hpp>
-#include<mesh_data/half_edge_mesh.hpp>
+#include<concepts/half_edge_mesh_data.hpp>
 
 template <MeshData Mesh>
 class OffWriter : public MeshWriter<Mesh> {
     private:
-        void writeOutputSeeds(std::ofstream& file, HalfEdgeMesh& mesh, std::vector<HalfEdgeMesh::OutputIndex> outputSeeds) requires std::same_as<Mesh, HalfEdgeMesh>;
+        void writeOutputSeeds(std::ofstream& file, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds) requires HalfEdgeMeshData<Mesh>;
         /**
          * Method to write the faces of this half edge based `mesh` to a file
          * 
@@ -14,7 +14,7 @@ class OffWriter : public MeshWriter<Mesh> {
          * @param file The output off file stream
          * @param mesh The half edge based mesh whose faces we need to write
          */
-        void writeFaces(std::ofstream& file, HalfEdgeMesh& mesh) requires std::same_as<Mesh, HalfEdgeMesh>;
+        void writeFaces(std::ofstream& file, Mesh& mesh) requires HalfEdgeMeshData<Mesh>;
     public:
         void writeMesh(const std::vector<std::filesystem::path>& files, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds = {}) override;
 };
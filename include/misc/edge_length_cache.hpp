@@ -0,0 +1,61 @@
+#ifndef EDGE_LENGTH_CACHE_HPP
+#define EDGE_LENGTH_CACHE_HPP
+#include <cstddef>
+#include <vector>
+#include <concepts/mesh_data.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <misc/parallel.hpp>
+
+/**
+ * Squared length of every edge of a half edge mesh, indexed by half edge.
+ *
+ * Each undirected edge is computed once, from the half edge with the smallest index of its twin pair, and stored for
+ * both half edges so reading it doesn't need the twin. It stays valid while the endpoints of the half edges don't
+ * change, which relinking `next` and `prev` to insert cavities or merge polygons doesn't do
+ */
+template <MeshData Mesh>
+class EdgeLengthCache {
+    public:
+        using EdgeIndex = typename Mesh::EdgeIndex;
+    private:
+        std::vector<double> lengths2;
+    public:
+        /**
+         * Fills the cache with the squared length of every edge of `mesh`, in parallel
+         */
+        void compute(const Mesh* mesh) requires HalfEdgeMeshData<Mesh> {
+            lengths2.resize(mesh->numberOfEdges());
+            parallel::forEach(0, lengths2.size(), [&](size_t edge) {
+                // Border edges of some meshes have no twin, `twin` is out of range then
+                size_t twin = mesh->twin(edge);
+                bool hasTwin = twin < lengths2.size();
+                if (!hasTwin || edge < twin) {
+                    double length2 = mesh->edgeLength2(edge);
+                    lengths2[edge] = length2;
+                    if (hasTwin) {
+                        lengths2[twin] = length2;
+                    }
+                }
+            });
+        }
+
+        /**
+         * Whether `compute` hasn't been called yet
+         */
+        bool empty() const {
+            return lengths2.empty();
+        }
+
+        /**
+         * @return The squared length of `edge`, same as `Mesh::edgeLength2`
+         */
+        double operator[](EdgeIndex edge) const {
+            return lengths2[edge];
+        }
+
+        size_t memoryUsage() const {
+            return sizeof(double) * lengths2.capacity();
+        }
+};
+
+#endif
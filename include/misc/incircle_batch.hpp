@@ -0,0 +1,214 @@
+#ifndef INCIRCLE_BATCH_HPP
+#define INCIRCLE_BATCH_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <mesh_data/structures/vertex.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define INCIRCLE_BATCH_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * Incircle tests of many triangles against the same point, as done for the frontier of a cavity search.
+ *
+ * The floating point filter of `predicates::incircle` is evaluated for several triangles at once with AVX-512 or AVX2,
+ * picked at runtime from what the CPU supports, and only the triangles it can't decide go through the scalar
+ * adaptive predicate. Results are the same as calling `Vertex::inCircle` on every triangle.
+ */
+namespace incircle_batch {
+    /**
+     * Coordinates of the triangles to test, one array per coordinate so they can be loaded in vector registers
+     */
+    struct Batch {
+        std::vector<double> ax, ay, bx, by, cx, cy;
+
+        size_t size() const {
+            return ax.size();
+        }
+        void clear() {
+            ax.clear(); ay.clear();
+            bx.clear(); by.clear();
+            cx.clear(); cy.clear();
+        }
+        /**
+         * Adds the counter-clockwise triangle `a`, `b`, `c`
+         */
+        void push(const Vertex& a, const Vertex& b, const Vertex& c) {
+            ax.push_back(a.x); ay.push_back(a.y);
+            bx.push_back(b.x); by.push_back(b.y);
+            cx.push_back(c.x); cy.push_back(c.y);
+        }
+    };
+
+    /**
+     * Hints the CPU to start loading the cache line of `address`
+     */
+    inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        (void) address;
+#endif
+    }
+
+    /**
+     * Result of the filter for a triangle of the batch
+     */
+    enum FilterResult : std::uint8_t {
+        OUTSIDE = 0,
+        INSIDE = 1,
+        UNDECIDED = 2
+    };
+
+#ifdef INCIRCLE_BATCH_X86
+    __attribute__((target("avx2")))
+    inline __m256d absAvx2(__m256d value) {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), value);
+    }
+
+    /**
+     * Filter of `predicates::incircle` for triangles [`begin`, `end`) of `batch`, 4 at a time
+     * @return Where it stopped, the remaining triangles are fewer than a vector
+     */
+    __attribute__((target("avx2")))
+    inline size_t filterAvx2(const Batch& batch, size_t begin, size_t end, double px, double py, std::uint8_t* result) {
+        const __m256d dx = _mm256_set1_pd(px);
+        const __m256d dy = _mm256_set1_pd(py);
+        const __m256d errorBoundFactor = _mm256_set1_pd(predicates::iccErrorBound);
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m256d adx = _mm256_sub_pd(_mm256_loadu_pd(&batch.ax[i]), dx);
+            __m256d ady = _mm256_sub_pd(_mm256_loadu_pd(&batch.ay[i]), dy);
+            __m256d bdx = _mm256_sub_pd(_mm256_loadu_pd(&batch.bx[i]), dx);
+            __m256d bdy = _mm256_sub_pd(_mm256_loadu_pd(&batch.by[i]), dy);
+            __m256d cdx = _mm256_sub_pd(_mm256_loadu_pd(&batch.cx[i]), dx);
+            __m256d cdy = _mm256_sub_pd(_mm256_loadu_pd(&batch.cy[i]), dy);
+
+            __m256d bdxcdy = _mm256_mul_pd(bdx, cdy), cdxbdy = _mm256_mul_pd(cdx, bdy);
+            __m256d aLift = _mm256_add_pd(_mm256_mul_pd(adx, adx), _mm256_mul_pd(ady, ady));
+            __m256d cdxady = _mm256_mul_pd(cdx, ady), adxcdy = _mm256_mul_pd(adx, cdy);
+            __m256d bLift = _mm256_add_pd(_mm256_mul_pd(bdx, bdx), _mm256_mul_pd(bdy, bdy));
+            __m256d adxbdy = _mm256_mul_pd(adx, bdy), bdxady = _mm256_mul_pd(bdx, ady);
+            __m256d cLift = _mm256_add_pd(_mm256_mul_pd(cdx, cdx), _mm256_mul_pd(cdy, cdy));
+
+            __m256d det = _mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(aLift, _mm256_sub_pd(bdxcdy, cdxbdy)),
+                _mm256_mul_pd(bLift, _mm256_sub_pd(cdxady, adxcdy))),
+                _mm256_mul_pd(cLift, _mm256_sub_pd(adxbdy, bdxady)));
+            __m256d permanent = _mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_add_pd(absAvx2(bdxcdy), absAvx2(cdxbdy)), aLift),
+                _mm256_mul_pd(_mm256_add_pd(absAvx2(cdxady), absAvx2(adxcdy)), bLift)),
+                _mm256_mul_pd(_mm256_add_pd(absAvx2(adxbdy), absAvx2(bdxady)), cLift));
+            __m256d errorBound = _mm256_mul_pd(errorBoundFactor, permanent);
+
+            int inside = _mm256_movemask_pd(_mm256_cmp_pd(det, errorBound, _CMP_GT_OQ));
+            int outside = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_sub_pd(_mm256_setzero_pd(), det), errorBound, _CMP_GT_OQ));
+            for (int lane = 0; lane < 4; ++lane) {
+                result[i + lane] = (inside >> lane) & 1 ? INSIDE : ((outside >> lane) & 1 ? OUTSIDE : UNDECIDED);
+            }
+        }
+        return i;
+    }
+
+    /**
+     * Same as `filterAvx2`, 8 triangles at a time
+     */
+    __attribute__((target("avx512f")))
+    inline size_t filterAvx512(const Batch& batch, size_t begin, size_t end, double px, double py, std::uint8_t* result) {
+        const __m512d dx = _mm512_set1_pd(px);
+        const __m512d dy = _mm512_set1_pd(py);
+        const __m512d errorBoundFactor = _mm512_set1_pd(predicates::iccErrorBound);
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m512d adx = _mm512_sub_pd(_mm512_loadu_pd(&batch.ax[i]), dx);
+            __m512d ady = _mm512_sub_pd(_mm512_loadu_pd(&batch.ay[i]), dy);
+            __m512d bdx = _mm512_sub_pd(_mm512_loadu_pd(&batch.bx[i]), dx);
+            __m512d bdy = _mm512_sub_pd(_mm512_loadu_pd(&batch.by[i]), dy);
+            __m512d cdx = _mm512_sub_pd(_mm512_loadu_pd(&batch.cx[i]), dx);
+            __m512d cdy = _mm512_sub_pd(_mm512_loadu_pd(&batch.cy[i]), dy);
+
+            __m512d bdxcdy = _mm512_mul_pd(bdx, cdy), cdxbdy = _mm512_mul_pd(cdx, bdy);
+            __m512d aLift = _mm512_add_pd(_mm512_mul_pd(adx, adx), _mm512_mul_pd(ady, ady));
+            __m512d cdxady = _mm512_mul_pd(cdx, ady), adxcdy = _mm512_mul_pd(adx, cdy);
+            __m512d bLift = _mm512_add_pd(_mm512_mul_pd(bdx, bdx), _mm512_mul_pd(bdy, bdy));
+            __m512d adxbdy = _mm512_mul_pd(adx, bdy), bdxady = _mm512_mul_pd(bdx, ady);
+            __m512d cLift = _mm512_add_pd(_mm512_mul_pd(cdx, cdx), _mm512_mul_pd(cdy, cdy));
+
+            __m512d det = _mm512_add_pd(_mm512_add_pd(
+                _mm512_mul_pd(aLift, _mm512_sub_pd(bdxcdy, cdxbdy)),
+                _mm512_mul_pd(bLift, _mm512_sub_pd(cdxady, adxcdy))),
+                _mm512_mul_pd(cLift, _mm512_sub_pd(adxbdy, bdxady)));
+            __m512d permanent = _mm512_add_pd(_mm512_add_pd(
+                _mm512_mul_pd(_mm512_add_pd(_mm512_abs_pd(bdxcdy), _mm512_abs_pd(cdxbdy)), aLift),
+                _mm512_mul_pd(_mm512_add_pd(_mm512_abs_pd(cdxady), _mm512_abs_pd(adxcdy)), bLift)),
+                _mm512_mul_pd(_mm512_add_pd(_mm512_abs_pd(adxbdy), _mm512_abs_pd(bdxady)), cLift));
+            __m512d errorBound = _mm512_mul_pd(errorBoundFactor, permanent);
+
+            __mmask8 inside = _mm512_cmp_pd_mask(det, errorBound, _CMP_GT_OQ);
+            __mmask8 outside = _mm512_cmp_pd_mask(_mm512_sub_pd(_mm512_setzero_pd(), det), errorBound, _CMP_GT_OQ);
+            for (int lane = 0; lane < 8; ++lane) {
+                result[i + lane] = (inside >> lane) & 1 ? INSIDE : ((outside >> lane) & 1 ? OUTSIDE : UNDECIDED);
+            }
+        }
+        return i;
+    }
+#endif
+
+    enum class Kernel {
+        SCALAR,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * @return The widest kernel the CPU running the program supports, detected once
+     */
+    inline Kernel kernel() {
+        static const Kernel detected = []() {
+#ifdef INCIRCLE_BATCH_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return Kernel::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return Kernel::AVX2;
+            }
+#endif
+            return Kernel::SCALAR;
+        }();
+        return detected;
+    }
+
+    /**
+     * Sets `inside[i]` to whether point `p` lies inside the circumcircle of triangle `i` of `batch` or is cocircular,
+     * same as `Vertex::inCircle`
+     */
+    inline void inCircle(const Batch& batch, const Vertex& p, std::vector<std::uint8_t>& inside) {
+        size_t size = batch.size();
+        inside.resize(size);
+        size_t filtered = 0;
+#ifdef INCIRCLE_BATCH_X86
+        switch (kernel()) {
+            case Kernel::AVX512:
+                filtered = filterAvx512(batch, 0, size, p.x, p.y, inside.data());
+                filtered = filterAvx2(batch, filtered, size, p.x, p.y, inside.data());
+                break;
+            case Kernel::AVX2:
+                filtered = filterAvx2(batch, 0, size, p.x, p.y, inside.data());
+                break;
+            case Kernel::SCALAR:
+                break;
+        }
+#endif
+        for (size_t i = 0; i < size; ++i) {
+            if (i >= filtered || inside[i] == UNDECIDED) {
+                inside[i] = predicates::incircle(batch.ax[i], batch.ay[i], batch.bx[i], batch.by[i], batch.cx[i], batch.cy[i], p.x, p.y) >= 0 ? INSIDE : OUTSIDE;
+            }
+        }
+    }
+}
+
+#undef INCIRCLE_BATCH_X86
+#endif
@@ -15,9 +15,13 @@ enum MemoryStat {
     M_EDGES_OUTPUT,
     M_VERTICES_INPUT,
     M_VERTICES_OUTPUT,
+    M_RECLAIMED_BY_COMPACTION,
+    M_CIRCUMCIRCLE_TABLE,
+    M_TRIANGLE_QUALITY_CACHE,
+    M_EDGE_LENGTH_CACHE,
 };
 
-inline constexpr unsigned int memoryStatAmount = 13;
+inline constexpr unsigned int memoryStatAmount = 17;
 
 inline constexpr const char* MemoryStatNames[memoryStatAmount] = {
     "memory_total",
@@ -32,7 +36,11 @@ inline constexpr const char* MemoryStatNames[memoryStatAmount] = {
     "memory_edges_input",
     "memory_edges_output",
     "memory_vertices_input",
-    "memory_vertices_output"
+    "memory_vertices_output",
+    "memory_reclaimed_by_compaction",
+    "memory_circumcircle_table",
+    "memory_triangle_quality_cache",
+    "memory_edge_length_cache"
 };
 
 #endif
\ No newline at end of file
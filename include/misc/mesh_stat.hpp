@@ -10,10 +10,12 @@ enum MeshStat {
     N_POLYGONS_BEFORE_POST_PROCESS,
     N_VERTICES,
     N_EDGES,
-    N_BORDER_EDGES
+    N_BORDER_EDGES,
+    N_ORIENT2D_FILTER_FAILURES,
+    N_INCIRCLE_FILTER_FAILURES
 };
 
-inline constexpr unsigned int meshStatAmount = 9;
+inline constexpr unsigned int meshStatAmount = 11;
 
 inline constexpr const char* MeshStatNames[meshStatAmount] = {
     "n_polygons",
@@ -24,7 +26,9 @@ inline constexpr const char* MeshStatNames[meshStatAmount] = {
     "n_polygons_before_post_process",
     "n_vertices",
     "n_edges",
-    "n_border_edges"
+    "n_border_edges",
+    "n_orient2d_filter_failures",
+    "n_incircle_filter_failures"
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <thread>
+#include <algorithm>
+
+/**
+ * Minimal fork-join helpers over `std::thread` for the data parallel loops of the mesh construction and generation.
+ *
+ * Every helper splits `[begin, end)` into at most `threadCount()` contiguous chunks and joins before returning,
+ * small ranges run on the calling thread only.
+ */
+namespace parallel {
+    /**
+     * Ranges smaller than this aren't worth spawning threads for
+     */
+    inline constexpr size_t minChunkSize = 1 << 14;
+
+    inline unsigned int& threadCountSetting() {
+        static unsigned int count = std::max(1u, std::thread::hardware_concurrency());
+        return count;
+    }
+
+    /**
+     * @return How many threads the parallel helpers use at most
+     */
+    inline unsigned int threadCount() {
+        return threadCountSetting();
+    }
+
+    /**
+     * Sets how many threads the parallel helpers use at most, 0 means every hardware thread
+     */
+    inline void setThreadCount(unsigned int count) {
+        threadCountSetting() = count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : count;
+    }
+
+    /**
+     * @return How many chunks `forEachChunk` splits a range of `size` elements into
+     */
+    inline size_t chunkCount(size_t size) {
+        return std::max<size_t>(1, std::min<size_t>(threadCount(), size / minChunkSize));
+    }
+
+    /**
+     * Calls `f(chunk, chunkBegin, chunkEnd)` once for each of the `chunkCount(end - begin)` contiguous chunks of `[begin, end)`,
+     * each on its own thread
+     */
+    template <typename F>
+    void forEachChunk(size_t begin, size_t end, F&& f) {
+        if (end <= begin) {
+            return;
+        }
+        size_t size = end - begin;
+        size_t chunks = chunkCount(size);
+        if (chunks == 1) {
+            f(size_t{0}, begin, end);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            workers.emplace_back([&f, chunk, begin, size, chunks]() {
+                f(chunk, begin + size * chunk / chunks, begin + size * (chunk + 1) / chunks);
+            });
+        }
+        f(size_t{0}, begin, begin + size / chunks);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Calls `f(i)` for every `i` in `[begin, end)`, `f` must be safe to call concurrently for different `i`
+     */
+    template <typename F>
+    void forEach(size_t begin, size_t end, F&& f) {
+        forEachChunk(begin, end, [&f](size_t, size_t chunkBegin, size_t chunkEnd) {
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                f(i);
+            }
+        });
+    }
+
+    /**
+     * Numbers the elements whose `keep` flag is set, in order, writing to `newIndex[i]` the position element `i` has among
+     * the kept ones (the entries of the other elements are left untouched)
+     * @return How many elements are kept
+     */
+    template <typename Index>
+    size_t enumerateKept(const std::vector<std::uint8_t>& keep, std::vector<Index>& newIndex) {
+        size_t size = keep.size();
+        std::vector<size_t> chunkOffsets(chunkCount(size) + 1, 0);
+        forEachChunk(0, size, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            chunkOffsets[chunk + 1] = std::count_if(keep.begin() + chunkBegin, keep.begin() + chunkEnd, [](std::uint8_t k) { return k != 0; });
+        });
+        for (size_t chunk = 1; chunk < chunkOffsets.size(); ++chunk) {
+            chunkOffsets[chunk] += chunkOffsets[chunk - 1];
+        }
+        forEachChunk(0, size, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            size_t next = chunkOffsets[chunk];
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                if (keep[i]) {
+                    newIndex[i] = static_cast<Index>(next++);
+                }
+            }
+        });
+        return chunkOffsets.back();
+    }
+
+    /**
+     * Stable least significant digit radix sort of `items` by the unsigned integer `key(item)`, which must fit in `keyBits` bits.
+     *
+     * Each pass builds per chunk histograms of one byte of the key in parallel, turns them into per chunk offsets and scatters
+     * every chunk in parallel. There are at most `keyBits / 8` rounded up passes, a pass where every item has the same byte
+     * skips the scatter since it wouldn't move anything.
+     */
+    template <typename T, typename KeyFunction>
+    void radixSort(std::vector<T>& items, KeyFunction key, unsigned int keyBits) {
+        constexpr unsigned int bitsPerPass = 8;
+        constexpr size_t buckets = size_t{1} << bitsPerPass;
+        size_t size = items.size();
+        size_t chunks = chunkCount(size);
+        std::vector<T> buffer(size);
+        std::vector<std::array<size_t, buckets>> offsets(chunks);
+        for (unsigned int shift = 0; shift < keyBits; shift += bitsPerPass) {
+            auto digit = [&key, shift](const T& item) {
+                return static_cast<size_t>((static_cast<std::uint64_t>(key(item)) >> shift) & (buckets - 1));
+            };
+            forEachChunk(0, size, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+                std::array<size_t, buckets>& histogram = offsets[chunk];
+                histogram.fill(0);
+                for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                    histogram[digit(items[i])]++;
+                }
+            });
+            size_t total = 0;
+            bool singleBucket = false;
+            for (size_t bucket = 0; bucket < buckets; ++bucket) {
+                size_t bucketBegin = total;
+                for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                    size_t count = offsets[chunk][bucket];
+                    offsets[chunk][bucket] = total;
+                    total += count;
+                }
+                singleBucket = singleBucket || (size > 0 && total - bucketBegin == size);
+            }
+            if (singleBucket) {
+                continue;
+            }
+            forEachChunk(0, size, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+                std::array<size_t, buckets>& offset = offsets[chunk];
+                for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                    buffer[offset[digit(items[i])]++] = items[i];
+                }
+            });
+            items.swap(buffer);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+#include <array>
+#include <cstdint>
+
+/**
+ * Philox4x32-10 counter based random number generator, from Salmon et al. "Parallel Random Numbers: As Easy as 1, 2, 3".
+ *
+ * Each output is a function of a key and a counter only, so the numbers for any counter can be computed independently,
+ * in any order and on any thread, and are the same for the same key
+ */
+namespace philox {
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    /**
+     * @return The 4 random words for `counter` under `key`
+     */
+    inline Counter philox4x32(Counter counter, Key key) {
+        constexpr std::uint32_t multiplier0 = 0xD2511F53;
+        constexpr std::uint32_t multiplier1 = 0xCD9E8D57;
+        constexpr std::uint32_t weyl0 = 0x9E3779B9;
+        constexpr std::uint32_t weyl1 = 0xBB67AE85;
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                key[0] += weyl0;
+                key[1] += weyl1;
+            }
+            std::uint64_t product0 = static_cast<std::uint64_t>(multiplier0) * counter[0];
+            std::uint64_t product1 = static_cast<std::uint64_t>(multiplier1) * counter[2];
+            counter = {
+                static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<std::uint32_t>(product1),
+                static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<std::uint32_t>(product0)
+            };
+        }
+        return counter;
+    }
+
+    /**
+     * @return 64 random bits for `index` under `seed`
+     */
+    inline std::uint64_t bits(std::uint64_t seed, std::uint64_t index) {
+        Counter words = philox4x32(
+            {static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), 0, 0},
+            {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)});
+        return (static_cast<std::uint64_t>(words[1]) << 32) | words[0];
+    }
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef TRIANGLE_QUALITY_CACHE_HPP
+#define TRIANGLE_QUALITY_CACHE_HPP
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <concepts/mesh_data.hpp>
+#include <mesh_data/structures/vertex.hpp>
+#include <misc/incircle_batch.hpp>
+#include <misc/parallel.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TRIANGLE_QUALITY_CACHE_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * Quality metrics a `TriangleQualityCache` can hold, combined as a bit mask
+ */
+enum QualityMetric : unsigned int {
+    Q_MIN_ANGLE = 1 << 0,
+    Q_MAX_ANGLE = 1 << 1,
+    Q_MIN_ANGLE_COS2 = 1 << 2,
+    Q_AREA2 = 1 << 3,
+    Q_MIN_EDGE_LENGTH2 = 1 << 4,
+    Q_MAX_EDGE_LENGTH2 = 1 << 5
+};
+
+/**
+ * Quality metrics of every triangle of a mesh, one array per metric, computed in a single pass over the triangles
+ * so the selection criteria and triangle comparators read them instead of recomputing the geometry of each triangle.
+ *
+ * Only the metrics in the mask given to `compute` are filled, the arrays of the rest stay empty. Every metric is
+ * evaluated with the same expressions the criteria and comparators use on the mesh, so both give the same results
+ */
+class TriangleQualityCache {
+    private:
+        /**
+         * Triangles gathered per block before computing their metrics
+         */
+        static constexpr size_t blockSize = 256;
+
+        /**
+         * Vertices of the triangles of a block, one array per coordinate
+         */
+        struct Block {
+            std::vector<double> ax, ay, bx, by, cx, cy;
+            Block() : ax(blockSize), ay(blockSize), bx(blockSize), by(blockSize), cx(blockSize), cy(blockSize) {}
+        };
+
+        /**
+         * Where the metrics of a block are written, the angles are written as the cosine `std::acos` is applied to
+         */
+        struct Output {
+            double* minAngle;
+            double* maxAngle;
+            double* minAngleCos2;
+            double* area2;
+            double* minEdgeLength2;
+            double* maxEdgeLength2;
+        };
+
+#ifdef TRIANGLE_QUALITY_CACHE_X86
+        /**
+         * Clamps `cosine` to [-1, 1] keeping NaN, as `std::clamp` does
+         */
+        __attribute__((target("avx2")))
+        static __m256d clampCosineAvx2(__m256d cosine) {
+            return _mm256_max_pd(_mm256_set1_pd(-1.0), _mm256_min_pd(_mm256_set1_pd(1.0), cosine));
+        }
+
+        /**
+         * `Metrics` of triangles [`begin`, `end`) of `block`, 4 at a time
+         * @return Where it stopped, the remaining triangles are fewer than a vector
+         */
+        template <unsigned int Metrics>
+        __attribute__((target("avx2")))
+        static size_t computeAvx2(const Block& block, size_t begin, size_t end, const Output& output) {
+            const __m256d signBit = _mm256_set1_pd(-0.0);
+            size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                __m256d ax = _mm256_loadu_pd(&block.ax[i]), ay = _mm256_loadu_pd(&block.ay[i]);
+                __m256d bx = _mm256_loadu_pd(&block.bx[i]), by = _mm256_loadu_pd(&block.by[i]);
+                __m256d cx = _mm256_loadu_pd(&block.cx[i]), cy = _mm256_loadu_pd(&block.cy[i]);
+
+                if constexpr ((Metrics & Q_AREA2) != 0) {
+                    __m256d area2 = _mm256_sub_pd(
+                        _mm256_mul_pd(_mm256_sub_pd(bx, ax), _mm256_sub_pd(cy, ay)),
+                        _mm256_mul_pd(_mm256_sub_pd(by, ay), _mm256_sub_pd(cx, ax)));
+                    _mm256_storeu_pd(output.area2 + i, area2);
+                }
+                if constexpr ((Metrics & ~Q_AREA2) == 0) {
+                    continue;
+                }
+
+                __m256d abx = _mm256_sub_pd(bx, ax), aby = _mm256_sub_pd(by, ay);
+                __m256d bcx = _mm256_sub_pd(cx, bx), bcy = _mm256_sub_pd(cy, by);
+                __m256d cax = _mm256_sub_pd(ax, cx), cay = _mm256_sub_pd(ay, cy);
+                __m256d ab2 = _mm256_add_pd(_mm256_mul_pd(abx, abx), _mm256_mul_pd(aby, aby));
+                __m256d bc2 = _mm256_add_pd(_mm256_mul_pd(bcx, bcx), _mm256_mul_pd(bcy, bcy));
+                __m256d ca2 = _mm256_add_pd(_mm256_mul_pd(cax, cax), _mm256_mul_pd(cay, cay));
+
+                if constexpr ((Metrics & Q_MIN_EDGE_LENGTH2) != 0) {
+                    _mm256_storeu_pd(output.minEdgeLength2 + i, _mm256_min_pd(_mm256_min_pd(ab2, bc2), ca2));
+                }
+                if constexpr ((Metrics & Q_MAX_EDGE_LENGTH2) != 0) {
+                    _mm256_storeu_pd(output.maxEdgeLength2 + i, _mm256_max_pd(_mm256_max_pd(ab2, bc2), ca2));
+                }
+
+                __m256d abDotCa = _mm256_add_pd(_mm256_mul_pd(abx, cax), _mm256_mul_pd(aby, cay));
+                __m256d abDotBc = _mm256_add_pd(_mm256_mul_pd(abx, bcx), _mm256_mul_pd(aby, bcy));
+                __m256d bcDotCa = _mm256_add_pd(_mm256_mul_pd(bcx, cax), _mm256_mul_pd(bcy, cay));
+
+                if constexpr ((Metrics & (Q_MIN_ANGLE | Q_MAX_ANGLE)) != 0) {
+                    __m256d ab = _mm256_sqrt_pd(ab2), bc = _mm256_sqrt_pd(bc2), ca = _mm256_sqrt_pd(ca2);
+                    __m256d cosineA = clampCosineAvx2(_mm256_div_pd(abDotCa, _mm256_mul_pd(ca, ab)));
+                    __m256d cosineB = clampCosineAvx2(_mm256_div_pd(_mm256_xor_pd(abDotBc, signBit), _mm256_mul_pd(ab, bc)));
+                    __m256d cosineC = clampCosineAvx2(_mm256_div_pd(_mm256_xor_pd(bcDotCa, signBit), _mm256_mul_pd(bc, ca)));
+                    // The smallest angle has the biggest cosine, ties and NaN keep the first one as std::min does
+                    if constexpr ((Metrics & Q_MIN_ANGLE) != 0) {
+                        _mm256_storeu_pd(output.minAngle + i, _mm256_max_pd(cosineC, _mm256_max_pd(cosineB, cosineA)));
+                    }
+                    if constexpr ((Metrics & Q_MAX_ANGLE) != 0) {
+                        _mm256_storeu_pd(output.maxAngle + i, _mm256_min_pd(cosineC, _mm256_min_pd(cosineB, cosineA)));
+                    }
+                }
+                if constexpr ((Metrics & Q_MIN_ANGLE_COS2) != 0) {
+                    // The smallest angle is opposite to the shortest edge
+                    __m256d abShortest = _mm256_and_pd(_mm256_cmp_pd(ab2, bc2, _CMP_LE_OQ), _mm256_cmp_pd(ab2, ca2, _CMP_LE_OQ));
+                    __m256d bcShortest = _mm256_cmp_pd(bc2, ca2, _CMP_LE_OQ);
+                    __m256d dot = _mm256_blendv_pd(_mm256_blendv_pd(abDotBc, abDotCa, bcShortest), bcDotCa, abShortest);
+                    __m256d length2Product = _mm256_blendv_pd(
+                        _mm256_blendv_pd(_mm256_mul_pd(ab2, bc2), _mm256_mul_pd(ab2, ca2), bcShortest),
+                        _mm256_mul_pd(ca2, bc2), abShortest);
+                    // The dot products of the sides around the angle are the opposite of `dot`
+                    __m256d cos2 = _mm256_div_pd(_mm256_mul_pd(dot, dot), length2Product);
+                    __m256d obtuse = _mm256_cmp_pd(dot, _mm256_setzero_pd(), _CMP_GT_OQ);
+                    _mm256_storeu_pd(output.minAngleCos2 + i, _mm256_blendv_pd(cos2, _mm256_xor_pd(cos2, signBit), obtuse));
+                }
+            }
+            return i;
+        }
+#endif
+        /**
+         * Same as `computeAvx2`, one triangle at a time
+         */
+        template <unsigned int Metrics>
+        static void computeScalar(const Block& block, size_t begin, size_t end, const Output& output) {
+            for (size_t i = begin; i < end; ++i) {
+                Vertex a{block.ax[i], block.ay[i]};
+                Vertex b{block.bx[i], block.by[i]};
+                Vertex c{block.cx[i], block.cy[i]};
+                if constexpr ((Metrics & Q_AREA2) != 0) {
+                    output.area2[i] = a.cross2d(b, c);
+                }
+                Vertex edgeAB = b - a;
+                Vertex edgeBC = c - b;
+                Vertex edgeCA = a - c;
+                double ab2 = edgeAB.dot(edgeAB);
+                double bc2 = edgeBC.dot(edgeBC);
+                double ca2 = edgeCA.dot(edgeCA);
+                if constexpr ((Metrics & Q_MIN_EDGE_LENGTH2) != 0) {
+                    output.minEdgeLength2[i] = std::min({ab2, bc2, ca2});
+                }
+                if constexpr ((Metrics & Q_MAX_EDGE_LENGTH2) != 0) {
+                    output.maxEdgeLength2[i] = std::max({ab2, bc2, ca2});
+                }
+                if constexpr ((Metrics & (Q_MIN_ANGLE | Q_MAX_ANGLE)) != 0) {
+                    double cosineA = std::clamp(edgeCA.dot(edgeAB) / (std::sqrt(ca2) * std::sqrt(ab2)), -1.0, 1.0);
+                    double cosineB = std::clamp(-edgeAB.dot(edgeBC) / (std::sqrt(ab2) * std::sqrt(bc2)), -1.0, 1.0);
+                    double cosineC = std::clamp(-edgeBC.dot(edgeCA) / (std::sqrt(bc2) * std::sqrt(ca2)), -1.0, 1.0);
+                    if constexpr ((Metrics & Q_MIN_ANGLE) != 0) {
+                        double cosine = cosineA;
+                        cosine = cosineB > cosine ? cosineB : cosine;
+                        output.minAngle[i] = cosineC > cosine ? cosineC : cosine;
+                    }
+                    if constexpr ((Metrics & Q_MAX_ANGLE) != 0) {
+                        double cosine = cosineA;
+                        cosine = cosineB < cosine ? cosineB : cosine;
+                        output.maxAngle[i] = cosineC < cosine ? cosineC : cosine;
+                    }
+                }
+                if constexpr ((Metrics & Q_MIN_ANGLE_COS2) != 0) {
+                    double dot;
+                    double length2Product;
+                    if (ab2 <= bc2 && ab2 <= ca2) {
+                        dot = edgeBC.dot(edgeCA);
+                        length2Product = ca2 * bc2;
+                    } else if (bc2 <= ca2) {
+                        dot = edgeAB.dot(edgeCA);
+                        length2Product = ab2 * ca2;
+                    } else {
+                        dot = edgeAB.dot(edgeBC);
+                        length2Product = ab2 * bc2;
+                    }
+                    double cos2 = (dot * dot) / length2Product;
+                    output.minAngleCos2[i] = dot > 0.0 ? -cos2 : cos2;
+                }
+            }
+        }
+
+        template <unsigned int Metrics>
+        static double* metricData(std::vector<double>& metric, QualityMetric flag, size_t offset) {
+            return (Metrics & flag) != 0 ? metric.data() + offset : nullptr;
+        }
+    public:
+        /**
+         * Smallest and biggest interior angle of each triangle, in radians
+         */
+        std::vector<double> minAngle;
+        std::vector<double> maxAngle;
+        /**
+         * Squared cosine of the smallest angle of each triangle, negative if the angle is obtuse
+         */
+        std::vector<double> minAngleCos2;
+        /**
+         * Twice the signed area of each triangle
+         */
+        std::vector<double> area2;
+        /**
+         * Squared length of the shortest and longest edge of each triangle
+         */
+        std::vector<double> minEdgeLength2;
+        std::vector<double> maxEdgeLength2;
+
+        /**
+         * Fills the arrays of the `Metrics` with the metrics of every triangle of `mesh`, in parallel
+         */
+        template <unsigned int Metrics, MeshData Mesh>
+        void compute(const Mesh* mesh) {
+            size_t nTriangles = mesh->numberOfPolygons();
+            for (auto [metric, flag] : {std::pair{&minAngle, Q_MIN_ANGLE}, {&maxAngle, Q_MAX_ANGLE}, {&minAngleCos2, Q_MIN_ANGLE_COS2},
+                                        {&area2, Q_AREA2}, {&minEdgeLength2, Q_MIN_EDGE_LENGTH2}, {&maxEdgeLength2, Q_MAX_EDGE_LENGTH2}}) {
+                metric->resize((Metrics & flag) != 0 ? nTriangles : 0);
+            }
+            parallel::forEachChunk(0, nTriangles, [&](size_t, size_t chunkBegin, size_t chunkEnd) {
+                Block block;
+                for (size_t blockBegin = chunkBegin; blockBegin < chunkEnd; blockBegin += blockSize) {
+                    size_t count = std::min(blockSize, chunkEnd - blockBegin);
+                    for (size_t i = 0; i < count; ++i) {
+                        Vertex v0, v1, v2;
+                        mesh->getVerticesOfTriangle(blockBegin + i, v0, v1, v2);
+                        block.ax[i] = v0.x;
+                        block.ay[i] = v0.y;
+                        block.bx[i] = v1.x;
+                        block.by[i] = v1.y;
+                        block.cx[i] = v2.x;
+                        block.cy[i] = v2.y;
+                    }
+                    Output output{
+                        metricData<Metrics>(minAngle, Q_MIN_ANGLE, blockBegin),
+                        metricData<Metrics>(maxAngle, Q_MAX_ANGLE, blockBegin),
+                        metricData<Metrics>(minAngleCos2, Q_MIN_ANGLE_COS2, blockBegin),
+                        metricData<Metrics>(area2, Q_AREA2, blockBegin),
+                        metricData<Metrics>(minEdgeLength2, Q_MIN_EDGE_LENGTH2, blockBegin),
+                        metricData<Metrics>(maxEdgeLength2, Q_MAX_EDGE_LENGTH2, blockBegin)
+                    };
+                    size_t computed = 0;
+#ifdef TRIANGLE_QUALITY_CACHE_X86
+                    if (incircle_batch::kernel() != incircle_batch::Kernel::SCALAR) {
+                        computed = computeAvx2<Metrics>(block, 0, count, output);
+                    }
+#endif
+                    computeScalar<Metrics>(block, computed, count, output);
+                    // acos is decreasing, so the acos of the extreme cosine is the extreme angle
+                    for (size_t i = 0; i < count; ++i) {
+                        if constexpr ((Metrics & Q_MIN_ANGLE) != 0) {
+                            output.minAngle[i] = std::acos(output.minAngle[i]);
+                        }
+                        if constexpr ((Metrics & Q_MAX_ANGLE) != 0) {
+                            output.maxAngle[i] = std::acos(output.maxAngle[i]);
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * @return The signed area of `triangle`
+         */
+        double area(size_t triangle) const {
+            return 0.5 * area2[triangle];
+        }
+
+        size_t memoryUsage() const {
+            return sizeof(double) * (minAngle.capacity() + maxAngle.capacity() + minAngleCos2.capacity() +
+                                     area2.capacity() + minEdgeLength2.capacity() + maxEdgeLength2.capacity());
+        }
+};
+
+#undef TRIANGLE_QUALITY_CACHE_X86
+#endif
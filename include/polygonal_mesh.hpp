@@ -55,6 +55,10 @@ TODO:
 #include <misc/mesh_stat.hpp>
 #include <misc/time_stat.hpp>
 #include <misc/memory_stat.hpp>
+#include <mesh_data/structures/vertex.hpp>
+#include <concepts/half_edge_mesh_data.hpp>
+#include <concepts/has_records_constructor.hpp>
+#include <mesh_data/half_edge_compaction.hpp>
 /**
  * Class that defines a polygonal mesh
  */
@@ -67,6 +71,18 @@ private:
     std::unique_ptr<MeshReader<Mesh>> reader;
     std::unique_ptr<MeshWriter<Mesh>> writer;
     std::unique_ptr<MeshGenerator<Mesh>> generator;
+    /**
+     * Output seeds of `refinedMesh` once it was compacted, the generator's ones refer to the mesh it returned
+     */
+    std::vector<typename Mesh::OutputIndex> compactedOutputSeeds;
+    bool isCompacted = false;
+    std::unordered_map<MemoryStat, unsigned long long> compactionMemory;
+    /**
+     * Predicate filter failures during the last `generateMesh`, the global counters also count the ones of the readers
+     * and of every previous generation
+     */
+    unsigned long long orient2dFilterFailures = 0;
+    unsigned long long incircleFilterFailures = 0;
 public:
     
     PolygonalMesh(std::unique_ptr<MeshReader<Mesh>> meshReader) : reader(std::move(meshReader)) {}
@@ -94,7 +110,34 @@ public:
         if (generator == nullptr) {
             throw std::runtime_error("Generator must be set before attempting to refine mesh");
         }
+        unsigned long long orient2dBefore = predicates::orient2dFilterFailures.load(std::memory_order_relaxed);
+        unsigned long long incircleBefore = predicates::incircleFilterFailures.load(std::memory_order_relaxed);
         refinedMesh = generator->generateMesh(meshData);
+        orient2dFilterFailures = predicates::orient2dFilterFailures.load(std::memory_order_relaxed) - orient2dBefore;
+        incircleFilterFailures = predicates::incircleFilterFailures.load(std::memory_order_relaxed) - incircleBefore;
+        return *this;
+    }
+    /**
+     * Replaces the refined mesh with a copy holding only the half edges and vertices of its output polygons
+     */
+    PolygonalMesh& compactOutputMesh() {
+        if constexpr (HalfEdgeMeshData<Mesh> && HasRecordsConstructor<Mesh>) {
+            if (refinedMesh == nullptr) {
+                throw std::runtime_error("Mesh must be generated before attempting to compact it");
+            }
+            unsigned long long edgesBefore = refinedMesh->getEdgesMemoryUsage();
+            unsigned long long verticesBefore = refinedMesh->getVertexMemoryUsage();
+            half_edge_compaction::CompactedMesh<Mesh> compacted = half_edge_compaction::compact(*refinedMesh, generator->getOutputSeeds());
+            delete refinedMesh;
+            refinedMesh = compacted.mesh;
+            compactedOutputSeeds = std::move(compacted.outputSeeds);
+            isCompacted = true;
+            compactionMemory[M_EDGES_OUTPUT] = refinedMesh->getEdgesMemoryUsage();
+            compactionMemory[M_VERTICES_OUTPUT] = refinedMesh->getVertexMemoryUsage();
+            compactionMemory[M_RECLAIMED_BY_COMPACTION] = (edgesBefore + verticesBefore) - (compactionMemory[M_EDGES_OUTPUT] + compactionMemory[M_VERTICES_OUTPUT]);
+        } else {
+            throw std::runtime_error("This mesh type can't be compacted");
+        }
         return *this;
     }
     PolygonalMesh& writeMeshBeforePostProcess(const std::vector<std::filesystem::path>& filepaths) {
@@ -107,14 +150,16 @@ public:
     }
     PolygonalMesh& writeOutputMesh(const std::vector<std::filesystem::path>& filepaths) {
         std::vector<typename Mesh::OutputIndex> output = {};
-        if (generator != nullptr) {
+        if (isCompacted) {
+            output = compactedOutputSeeds;
+        } else if (generator != nullptr) {
             output = generator->getOutputSeeds();
         }
         writer->writeMesh(filepaths, *refinedMesh, output);
         return *this;
     }
     void writeStatsToJson(const std::filesystem::path& filepath) {
-        std::unordered_map<MeshStat,int> meshStats = getGenerationStats();
+        std::unordered_map<MeshStat, unsigned long long> meshStats = getGenerationStats();
         std::unordered_map<TimeStat,double> timeStats = getGenerationTimes();
         std::unordered_map<MemoryStat, unsigned long long> memoryStats = getGenerationMemory();
         std::ofstream json(filepath);
@@ -149,12 +194,17 @@ public:
     const Mesh& getRefinedMeshData() const {
         return refinedMesh;
     }
-    std::unordered_map<MeshStat,int> getGenerationStats() const {
+    std::unordered_map<MeshStat, unsigned long long> getGenerationStats() const {
         if (generator != nullptr) {
-            std::unordered_map<MeshStat,int> stats = generator->getGenerationStats();
+            std::unordered_map<MeshStat, unsigned long long> stats;
+            for (const auto& [stat, value] : generator->getGenerationStats()) {
+                stats[stat] = static_cast<unsigned long long>(value);
+            }
+            stats[N_ORIENT2D_FILTER_FAILURES] = orient2dFilterFailures;
+            stats[N_INCIRCLE_FILTER_FAILURES] = incircleFilterFailures;
             return stats;
         } else {
-            return std::unordered_map<MeshStat,int>{};
+            return std::unordered_map<MeshStat, unsigned long long>{};
         }
     }
     std::unordered_map<TimeStat,double> getGenerationTimes() const {
@@ -170,6 +220,14 @@ public:
     std::unordered_map<MemoryStat,unsigned long long> getGenerationMemory() const {
         if (generator != nullptr) {
             std::unordered_map<MemoryStat,unsigned long long> stats = generator->getGenerationMemory();
+            if (isCompacted) {
+                if (auto total = stats.find(M_TOTAL); total != stats.end()) {
+                    total->second -= compactionMemory.at(M_RECLAIMED_BY_COMPACTION);
+                }
+                for (const auto& [key, value] : compactionMemory) {
+                    stats[key] = value;
+                }
+            }
             return stats;
         } else {
             return std::unordered_map<MemoryStat,unsigned long long>{};
@@ -8,7 +8,7 @@ import re
 # Macro options
 # -------------------------------
 MESH_GENERATOR_OPTIONS = ["DelaunayCavityGenerator", "PolyllaGenerator"]
-MESH_TYPE_OPTIONS = ["HalfEdgeMesh"]
+MESH_TYPE_OPTIONS = ["HalfEdgeMesh", "SoAHalfEdgeMesh", "CornerTableMesh", "CompactHalfEdgeMesh", "OverlayHalfEdgeMesh"]
 TRIANGLE_COMPARATOR_BASE_T_OPTIONS = ["NullComparator", "EdgeLengthComparator", "AngleComparator", "AreaComparator", "RandomComparator"]
 COMPARATOR_SORT_KEYS = {
     "EdgeLengthComparator": ["MinEdge","MaxEdge"],
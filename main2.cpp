@@ -14,7 +14,104 @@
 #include <mesh_generators/selection_criteria/selection_criteria.hpp>
 #include <CLI/CLI.hpp>
 #include <mesh_io/off_reader.hpp>
+#include <mesh_io/binary_mesh_reader.hpp>
+#include <mesh_io/binary_mesh_writer.hpp>
 #include <polygonal_mesh.hpp>
+#include <mesh_data/wide_index_mesh.hpp>
+#include <misc/parallel.hpp>
+
+struct RunOptions {
+    bool readFromOff;
+    bool readFromBinary;
+    bool convertToBinary;
+    bool compactOutput;
+    bool precomputeCircumcircles;
+    bool writeOff;
+    bool writeAle;
+    bool writeJson;
+    bool writeBeforePost;
+    bool spatialReorder;
+    bool originalVertexIds;
+    unsigned int randomSeed;
+    double selectionCriterionThreshold;
+    std::string output;
+};
+
+/**
+ * Reads, refines and writes the mesh using `Mesh` as the mesh type, so the same pipeline can run
+ * with the configured mesh type or with its 64 bit index variant
+ */
+template <MeshData Mesh>
+void runGenerator(const std::vector<std::filesystem::path>& inputPaths, const RunOptions& options) {
+    std::unique_ptr<MeshReader<Mesh>> reader;
+    
+    if (options.readFromBinary) {
+        reader = std::make_unique<BinaryMeshReader<Mesh>>();
+    } else if (options.readFromOff) {
+        reader = std::make_unique<OffReader<Mesh>>();
+    } else {
+        reader = std::make_unique<NodeEleReader<Mesh>>();
+    }
+    reader->setSpatialReordering(options.spatialReorder);
+
+    if (options.convertToBinary) {
+        // Only pay for parsing the text input once, later runs read the binary file instead
+        std::unique_ptr<Mesh> mesh(reader->readMesh(inputPaths));
+        BinaryMeshWriter<Mesh>().writeMesh({options.output + binary_mesh_format::extension}, *mesh);
+        return;
+    }
+    
+    PolygonalMesh<Mesh> polygonalMesh(std::move(reader));
+    #ifdef SELECTION_CRITERION_WITH_ARG
+        auto generator = std::make_unique<MESH_GENERATOR_FOR(Mesh)>(SELECTION_CRITERION_CONSTRUCTOR_FOR(Mesh, options.selectionCriterionThreshold), options.writeBeforePost);
+    #else
+        #ifdef DELAUNAY_GENERATOR
+            auto generator = std::make_unique<MESH_GENERATOR_FOR(Mesh)>(options.writeBeforePost);
+        #else
+            auto generator = std::make_unique<MESH_GENERATOR_FOR(Mesh)>();
+        #endif
+    #endif
+    #ifdef DELAUNAY_GENERATOR
+        generator->setPrecomputeCircumcircles(options.precomputeCircumcircles);
+        if constexpr (isRandomComparator<TRIANGLE_COMPARATOR_FOR(Mesh) , Mesh>) {
+            if (options.randomSeed != 0) {
+                generator->setRandomSeed(options.randomSeed);
+            }
+        }
+    #endif
+    polygonalMesh.setGenerator(std::move(generator));
+    
+    polygonalMesh.readMeshFromFiles(inputPaths)
+        .generateMesh();
+    if constexpr (HasRecordsConstructor<Mesh>) {
+        if (options.compactOutput) {
+            polygonalMesh.compactOutputMesh();
+        }
+    }
+    
+    if (options.writeOff || options.writeAle) {
+        auto writeMesh = [&](auto writerCreator, const std::string& ext) {
+            std::unique_ptr<MeshWriter<Mesh>> writer = writerCreator();
+            writer->setWriteOriginalVertexIds(options.originalVertexIds);
+            polygonalMesh.setWriter(std::move(writer));
+            polygonalMesh.writeOutputMesh({options.output + ext});
+            if (options.writeBeforePost) {
+                polygonalMesh.writeMeshBeforePostProcess({options.output + "_intermediate" + ext});
+            }
+        };
+
+        if (options.writeOff)
+            writeMesh([] { return std::make_unique<OffWriter<Mesh>>(); }, ".off");
+
+        if (options.writeAle)
+            writeMesh([] { return std::make_unique<AleWriter<Mesh>>(); }, ".ale");
+    }
+
+
+    if (options.writeJson) {
+        polygonalMesh.writeStatsToJson({options.output + ".json"});
+    }
+}
 
 int main(int argc, char **argv) {
     CLI::App app{std::string{"CLI Tool to refine a triangular mesh of arbitrary polygons using: "} + std::string{TOSTRING((MESH_GENERATOR))}};
@@ -23,15 +120,19 @@ int main(int argc, char **argv) {
     bool writeJson{false};
     bool writeAle{false};
     bool writeBeforePost{false};
+    bool spatialReorder{false};
+    bool originalVertexIds{false};
     std::string input1, input2, input3, output;
     
     CLI::Option* offOpt = app.add_flag("--off-input",readFromOff, "Read input from an off file");
     #ifdef DELAUNAY_GENERATOR
         unsigned int randomSeed{0};
         double selectionCriterionThreshold{20.0};
+        bool precomputeCircumcircles{false};
         if constexpr (!isNullSelectionCriterion<SELECTION_CRITERION , MESH_TYPE>) {
             CLI::Option* selectionArgOpt = app.add_option("--threshold", selectionCriterionThreshold, "Threshold to use for selection criterion");
         }
+        CLI::Option* circumcircleTableOpt = app.add_flag("--circumcircle-table", precomputeCircumcircles, "Compute the circumcircle of every triangle before the cavities");
         if constexpr (isRandomComparator<TRIANGLE_COMPARATOR , MESH_TYPE>) {
             CLI::Option* seedOpt = app.add_option("--seed", randomSeed, "Seed to use to sort triangles");
         }
@@ -53,7 +154,17 @@ int main(int argc, char **argv) {
     CLI::Option* writeOffOpt = app.add_flag("--off-output", writeOff, "Write to off file");
     CLI::Option* writeAleOpt = app.add_flag("--ale-output", writeAle, "Write to ale file");
     CLI::Option* writeJsonOpt = app.add_flag("--json-output", writeJson, "Write stats to json file");
-    CLI::Option* input1Opt = app.add_option("--input1", input1, "First input file, must be either .node or .off")->required();
+    unsigned int threads{0};
+    CLI::Option* threadsOpt = app.add_option("--threads", threads, "Maximum number of threads used by the parallel phases, 0 uses every hardware thread");
+    CLI::Option* spatialReorderOpt = app.add_flag("--spatial-reorder", spatialReorder, "Renumber vertices and triangles along a Hilbert curve after reading the input");
+    bool convertToBinary{false};
+    bool compactOutput{false};
+    if constexpr (HasRecordsConstructor<MESH_TYPE>) {
+        CLI::Option* compactOutputOpt = app.add_flag("--compact-output", compactOutput, "Remove the half edges and vertices left unused by the generator before writing the output");
+    }
+    CLI::Option* convertToBinaryOpt = app.add_flag("--convert-binary", convertToBinary, "Only convert the input to a .hemesh binary mesh, which can be given as --input1 later on");
+    CLI::Option* originalIdsOpt = app.add_flag("--original-ids", originalVertexIds, "Write vertices with their ids from the input files when they were renumbered");
+    CLI::Option* input1Opt = app.add_option("--input1", input1, "First input file, must be either .node, .off or .hemesh")->required();
     input1Opt->check(CLI::ExistingFile);
     auto additionalInputGroup = app.add_option_group("Input groups");
     additionalInputGroup->add_option("--input2", input2, ".ele file")->check(CLI::ExistingFile);
@@ -63,14 +174,9 @@ int main(int argc, char **argv) {
     app.allow_extras();
 
     CLI11_PARSE(app,argc,argv);
-    #ifdef DELAUNAY_GENERATOR
-    if constexpr (isRandomComparator<TRIANGLE_COMPARATOR , MESH_TYPE>) {
-        if (randomSeed != 0) {
-            RandomComparator<MESH_TYPE>::setSeed(randomSeed);
-        }
-    }
-    #endif
-    if (!readFromOff) {
+    parallel::setThreadCount(threads);
+    bool readFromBinary = std::filesystem::path(input1).extension() == binary_mesh_format::extension;
+    if (!readFromOff && !readFromBinary) {
         if (input2.empty()) {
             throw CLI::ValidationError("At least a .node and .ele file are required");
         }
@@ -79,50 +185,44 @@ int main(int argc, char **argv) {
     if (output.empty()) {
         output = input1.substr(0, input1.find_last_of('.')) + "_output";
     }
-    std::unique_ptr<MeshReader<MESH_TYPE>> reader;
-    
-    if (readFromOff) {
-        reader = std::make_unique<OffReader<MESH_TYPE>>();
-    } else {
-        reader = std::make_unique<NodeEleReader<MESH_TYPE>>();
-    }
-    
     std::vector<std::filesystem::path> inputPaths{input1,input2,input3};
-    
-    PolygonalMesh<MESH_TYPE> polygonalMesh(std::move(reader));
-    #ifdef SELECTION_CRITERION_WITH_ARG
-        polygonalMesh.setGenerator(std::make_unique<MESH_GENERATOR>(SELECTION_CRITERION_CONSTRUCTOR(selectionCriterionThreshold), writeBeforePost));
-    #else
-        #ifdef DELAUNAY_GENERATOR
-            polygonalMesh.setGenerator(std::make_unique<MESH_GENERATOR>(writeBeforePost));
-        #else
-            polygonalMesh.setGenerator(std::make_unique<MESH_GENERATOR>());
-        #endif
+    RunOptions options{
+        .readFromOff = readFromOff,
+        .readFromBinary = readFromBinary,
+        .convertToBinary = convertToBinary,
+        .compactOutput = compactOutput,
+        .precomputeCircumcircles = false,
+        .writeOff = writeOff,
+        .writeAle = writeAle,
+        .writeJson = writeJson,
+        .writeBeforePost = writeBeforePost,
+        .spatialReorder = spatialReorder,
+        .originalVertexIds = originalVertexIds,
+        .randomSeed = 0,
+        .selectionCriterionThreshold = 0.0,
+        .output = output
+    };
+    #ifdef DELAUNAY_GENERATOR
+    options.randomSeed = randomSeed;
+    options.selectionCriterionThreshold = selectionCriterionThreshold;
+    options.precomputeCircumcircles = precomputeCircumcircles;
     #endif
-    
-    polygonalMesh.readMeshFromFiles({input1, input2, input3})
-        .generateMesh();
-    
-    if (writeOff || writeAle) {
-        auto writeMesh = [&](auto writerCreator, const std::string& ext) {
-            std::unique_ptr<MeshWriter<MESH_TYPE>> writer = writerCreator();
-            polygonalMesh.setWriter(std::move(writer));
-            polygonalMesh.writeOutputMesh({output + ext});
-            if (writeBeforePost) {
-                polygonalMesh.writeMeshBeforePostProcess({output + "_intermediate" + ext});
-            }
-        };
 
-        if (writeOff)
-            writeMesh([] { return std::make_unique<OffWriter<MESH_TYPE>>(); }, ".off");
-
-        if (writeAle)
-            writeMesh([] { return std::make_unique<AleWriter<MESH_TYPE>>(); }, ".ale");
+    // Use the narrow indices of MESH_TYPE whenever the input fits, and its 64 bit variant otherwise,
+    // binary meshes were already written with one of them
+    bool useNarrowIndices;
+    if (readFromBinary) {
+        useNarrowIndices = binary_mesh_format::readHeader(inputPaths[0]).indexBytes == sizeof(typename MESH_TYPE::EdgeIndex);
+    } else {
+        MeshSize inputSize = readFromOff ? OffReader<MESH_TYPE>().readMeshSize(inputPaths) : NodeEleReader<MESH_TYPE>().readMeshSize(inputPaths);
+        useNarrowIndices = indicesFit<MESH_TYPE>(inputSize.nVertices, inputSize.nTriangles);
     }
-
-
-    if (writeJson) {
-        polygonalMesh.writeStatsToJson({output + ".json"});
+    if (useNarrowIndices) {
+        runGenerator<MESH_TYPE>(inputPaths, options);
+    } else if constexpr (!std::same_as<WideIndexMeshT<MESH_TYPE>, MESH_TYPE>) {
+        runGenerator<WideIndexMeshT<MESH_TYPE>>(inputPaths, options);
+    } else {
+        throw std::runtime_error(std::string{"Input mesh is too big for the indices of "} + TOSTRING(MESH_TYPE));
     }
 
 	return 0;
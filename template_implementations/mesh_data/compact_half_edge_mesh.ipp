@@ -0,0 +1,61 @@
+#ifndef COMPACT_HALF_EDGE_MESH_HPP
+#include <mesh_data/compact_half_edge_mesh.hpp>
+#endif
+
+#define COMPACT_HALF_EDGE_MESH_TEMPLATE template <AccessPolicy Access>
+#define COMPACT_HALF_EDGE_MESH_CLASS BasicCompactHalfEdgeMesh<Access>
+
+COMPACT_HALF_EDGE_MESH_TEMPLATE
+inline void COMPACT_HALF_EDGE_MESH_CLASS::appendHalfEdge(const HalfEdge& he) {
+    EdgeIndex edge = halfEdges.size();
+    halfEdges.push_back(CompactHalfEdge{
+        .origin = he.origin,
+        .twin = he.twin,
+        .next = he.next,
+        .face = he.face,
+        .isBorder = he.isBorder
+    });
+    setPrev(edge, he.prev);
+}
+
+COMPACT_HALF_EDGE_MESH_TEMPLATE
+inline void COMPACT_HALF_EDGE_MESH_CLASS::setHalfEdge(EdgeIndex edge, const HalfEdge& he) {
+    Access::get(halfEdges, edge) = CompactHalfEdge{
+        .origin = he.origin,
+        .twin = he.twin,
+        .next = he.next,
+        .face = he.face,
+        .isBorder = he.isBorder
+    };
+    setPrev(edge, he.prev);
+}
+
+COMPACT_HALF_EDGE_MESH_TEMPLATE
+COMPACT_HALF_EDGE_MESH_CLASS::BasicCompactHalfEdgeMesh(std::vector<VertexType> vertices,
+                                                       std::vector<EdgeType> edges,
+                                                       std::vector<FaceIndex> faces) : vertices(vertices), halfEdges(edges), polygons((faces.size() / 3)) {
+    this->nPolygons = faces.size() / 3;
+    interiorEdgeCount = edges.size() + 3 * this->nPolygons;
+    halfEdges.reserve(interiorEdgeCount);
+    this->constructInteriorHalfEdgesFromFaces(faces);
+    this->constructExteriorHalfEdges();
+    this->nHalfEdges = halfEdges.size();
+    this->nVertices = vertices.size();
+}
+
+COMPACT_HALF_EDGE_MESH_TEMPLATE
+COMPACT_HALF_EDGE_MESH_CLASS::BasicCompactHalfEdgeMesh(std::vector<VertexType> vertices,
+                                                       std::vector<EdgeType> edges,
+                                                       std::vector<FaceIndex> faces,
+                                                       std::vector<FaceIndex> neighbors) : vertices(vertices), halfEdges(edges), polygons((faces.size() / 3)) {
+    this->nPolygons = faces.size() / 3;
+    interiorEdgeCount = edges.size() + 3 * this->nPolygons;
+    halfEdges.reserve(interiorEdgeCount);
+    this->constructInteriorHalfEdgesFromFacesAndNeighs(faces, neighbors);
+    this->constructExteriorHalfEdges();
+    this->nHalfEdges = halfEdges.size();
+    this->nVertices = vertices.size();
+}
+
+#undef COMPACT_HALF_EDGE_MESH_CLASS
+#undef COMPACT_HALF_EDGE_MESH_TEMPLATE
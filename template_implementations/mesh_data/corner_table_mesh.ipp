@@ -0,0 +1,75 @@
+#ifndef CORNER_TABLE_MESH_HPP
+#include <mesh_data/corner_table_mesh.hpp>
+#endif
+
+#define CORNER_TABLE_MESH_TEMPLATE template <AccessPolicy Access>
+#define CORNER_TABLE_MESH_CLASS BasicCornerTableMesh<Access>
+
+CORNER_TABLE_MESH_TEMPLATE
+inline void CORNER_TABLE_MESH_CLASS::appendHalfEdge(const HalfEdge& he) {
+    EdgeIndex edge = cornerVertices.size();
+    cornerVertices.push_back(he.origin);
+    opposites.push_back(he.twin);
+    setNext(edge, he.next);
+    setPrev(edge, he.prev);
+    setFaceToEdge(he.face, edge);
+}
+
+CORNER_TABLE_MESH_TEMPLATE
+inline void CORNER_TABLE_MESH_CLASS::setHalfEdge(EdgeIndex edge, const HalfEdge& he) {
+    Access::get(cornerVertices, edge) = he.origin;
+    Access::get(opposites, edge) = he.twin;
+    setNext(edge, he.next);
+    setPrev(edge, he.prev);
+    setFaceToEdge(he.face, edge);
+}
+
+CORNER_TABLE_MESH_TEMPLATE
+inline typename CORNER_TABLE_MESH_CLASS::EdgeType CORNER_TABLE_MESH_CLASS::getEdge(EdgeIndex e) const {
+    return HalfEdge{
+        .origin = origin(e),
+        .twin = twin(e),
+        .next = next(e),
+        .prev = prev(e),
+        .face = getFaceOfEdge(e),
+        .isBorder = isBorderEdge(e)
+    };
+}
+
+CORNER_TABLE_MESH_TEMPLATE
+CORNER_TABLE_MESH_CLASS::BasicCornerTableMesh(std::vector<VertexType> vertices,
+                                              std::vector<EdgeType> edges,
+                                              std::vector<FaceIndex> faces) : vertices(vertices), triangleCount(faces.size() / 3) {
+    this->nPolygons = faces.size() / 3;
+    interiorEdgeCount = edges.size() + 3 * this->nPolygons;
+    cornerVertices.reserve(interiorEdgeCount);
+    opposites.reserve(interiorEdgeCount);
+    for (const HalfEdge& he : edges) {
+        appendHalfEdge(he);
+    }
+    this->constructInteriorHalfEdgesFromFaces(faces);
+    this->constructExteriorHalfEdges();
+    this->nHalfEdges = cornerVertices.size();
+    this->nVertices = vertices.size();
+}
+
+CORNER_TABLE_MESH_TEMPLATE
+CORNER_TABLE_MESH_CLASS::BasicCornerTableMesh(std::vector<VertexType> vertices,
+                                              std::vector<EdgeType> edges,
+                                              std::vector<FaceIndex> faces,
+                                              std::vector<FaceIndex> neighbors) : vertices(vertices), triangleCount(faces.size() / 3) {
+    this->nPolygons = faces.size() / 3;
+    interiorEdgeCount = edges.size() + 3 * this->nPolygons;
+    cornerVertices.reserve(interiorEdgeCount);
+    opposites.reserve(interiorEdgeCount);
+    for (const HalfEdge& he : edges) {
+        appendHalfEdge(he);
+    }
+    this->constructInteriorHalfEdgesFromFacesAndNeighs(faces, neighbors);
+    this->constructExteriorHalfEdges();
+    this->nHalfEdges = cornerVertices.size();
+    this->nVertices = vertices.size();
+}
+
+#undef CORNER_TABLE_MESH_CLASS
+#undef CORNER_TABLE_MESH_TEMPLATE
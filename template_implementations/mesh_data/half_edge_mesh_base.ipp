@@ -0,0 +1,429 @@
+#ifndef HALF_EDGE_MESH_BASE_HPP
+#include <mesh_data/half_edge_mesh_base.hpp>
+#endif
+
+#define HALF_EDGE_MESH_BASE_TEMPLATE template <typename Derived, PrimitiveIntegral Index>
+#define HALF_EDGE_MESH_BASE_CLASS HalfEdgeMeshBase<Derived, Index>
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+std::vector<typename HALF_EDGE_MESH_BASE_CLASS::FaceIndex> HALF_EDGE_MESH_BASE_CLASS::getNeighbors(FaceIndex polygon) const {
+    std::vector<FaceIndex> neighbors;
+    for (auto [edge, neighbor] : facesAround(polygon)) {
+        if (neighbor != invalidIndexValue) {
+            neighbors.push_back(neighbor);
+        }
+    }
+    return neighbors;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+typename HALF_EDGE_MESH_BASE_CLASS::EdgeIndex HALF_EDGE_MESH_BASE_CLASS::getTriangleSharedEdge(FaceIndex triangle1, FaceIndex triangle2) const {
+    EdgeIndex firstEdge = derived().getPolygon(triangle1);
+    EdgeIndex currentEdge = firstEdge;
+
+    do {
+        EdgeIndex twinEdge = derived().twin(currentEdge);
+        if (twinEdge != invalidIndexValue && derived().getFaceOfEdge(twinEdge) == triangle2) {
+            return currentEdge;
+        }
+        currentEdge = derived().next(currentEdge);
+    } while (firstEdge != currentEdge);
+    return invalidIndexValue;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+unsigned int HALF_EDGE_MESH_BASE_CLASS::degree(VertexIndex vertex) const {
+    return std::ranges::distance(edgesAroundVertex(vertex));
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+double HALF_EDGE_MESH_BASE_CLASS::edgeLength2(EdgeIndex edge) const {
+    const Vertex& originVertex = derived().getVertex(derived().origin(edge));
+    const Vertex& targetVertex = derived().getVertex(target(edge));
+    Vertex vectorFromTargetToOrigin = targetVertex - originVertex;
+    return vectorFromTargetToOrigin.dot(vectorFromTargetToOrigin); //Same as squared distance
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline void HALF_EDGE_MESH_BASE_CLASS::getVerticesOfTriangle(FaceIndex polygonIndex, Vertex& v0, Vertex& v1, Vertex& v2) const {
+    // We look for this edge first to guarantee CCW ordering
+    EdgeIndex firstEdge = derived().getPolygon(polygonIndex);
+    v0 = derived().getVertex(derived().origin(firstEdge));
+    v1 = derived().getVertex(target(firstEdge));
+    v2 = derived().getVertex(target(derived().next(firstEdge)));
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline std::array<typename HALF_EDGE_MESH_BASE_CLASS::EdgeIndex, 3> HALF_EDGE_MESH_BASE_CLASS::getEdgesOfTriangle(FaceIndex triangle) const {
+    EdgeIndex edge1 = derived().getPolygon(triangle);
+    EdgeIndex edge2 = derived().next(edge1);
+    EdgeIndex edge3 = derived().next(edge2);
+    return {edge1, edge2, edge3};
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline bool HALF_EDGE_MESH_BASE_CLASS::isPolygonSimple(OutputIndex seed) const {
+    EdgeIndex currentEdge = derived().next(seed);
+    //travel inside frontier-edges of polygon
+    while(currentEdge != seed){
+        //if the twin of the next halfedge is the current halfedge, then the polygon is not simple
+        if(derived().twin(derived().next(currentEdge)) == currentEdge)
+            return false;
+        //travel to next half-edge
+        currentEdge = derived().next(currentEdge);
+    }
+    return true;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline size_t HALF_EDGE_MESH_BASE_CLASS::getOutputSeedEdgeCount(OutputIndex seedIndex) const
+{
+    EdgeIndex currentEdge = seedIndex;
+    size_t edgeCount = 0;
+    do {
+        ++edgeCount;
+        currentEdge = derived().next(currentEdge);
+    } while (currentEdge != seedIndex);
+    return edgeCount;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline std::vector<typename HALF_EDGE_MESH_BASE_CLASS::EdgeIndex> HALF_EDGE_MESH_BASE_CLASS::getSharedEdges(OutputIndex seed1, OutputIndex seed2) const {
+    std::unordered_set<EdgeIndex> seed2Edges;
+    std::vector<EdgeIndex> sharedEdges;
+    for (auto [edge, neighbor] : facesAroundSeed(seed2)) {
+        seed2Edges.insert(edge);
+    }
+    for (auto [edge, neighbor] : facesAroundSeed(seed1)) {
+        if (neighbor != invalidIndexValue && seed2Edges.contains(derived().twin(edge))) {
+            sharedEdges.push_back(edge);
+        }
+    }
+    return sharedEdges;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline std::vector<typename HALF_EDGE_MESH_BASE_CLASS::ConnectivityBackupT> HALF_EDGE_MESH_BASE_CLASS::mergeSeeds(OutputIndex seedIndexToMergeInto, std::pair<OutputIndex,std::vector<EdgeIndex>> seedIndexToMergeFrom) {
+    std::vector<ConnectivityBackup> backupInfo;
+    FaceIndex newFaceIndex = derived().getFaceOfEdge(seedIndexToMergeInto);
+
+    auto collectEdges = [&](EdgeIndex edgeToMergeFrom) {
+        EdgeIndex twinEdge      = derived().twin(edgeToMergeFrom);
+        EdgeIndex prevToShared  = derived().prev(twinEdge);
+        EdgeIndex nextToShared  = derived().next(twinEdge);
+        EdgeIndex prevOfCurrent = derived().prev(edgeToMergeFrom);
+        EdgeIndex nextOfCurrent = derived().next(edgeToMergeFrom);
+
+        return std::array<EdgeIndex,6>{
+            prevToShared, nextToShared, prevOfCurrent, nextOfCurrent, twinEdge, edgeToMergeFrom
+        };
+    };
+
+    auto connectEdges = [&](EdgeIndex edge1, EdgeIndex edge2) {
+        derived().setNext(edge1, edge2);
+        derived().setPrev(edge2, edge1);
+    };
+
+    auto setFaces = [&](FaceIndex face, std::initializer_list<EdgeIndex> list) {
+        for (EdgeIndex x : list) derived().setFaceToEdge(face, x);
+    };
+
+    for (EdgeIndex edgeToMergeFrom : seedIndexToMergeFrom.second) {
+        std::array<EdgeIndex,6> edges = collectEdges(edgeToMergeFrom);
+        std::array<EdgeIndex,6> origNext, origPrev;
+        std::array<FaceIndex,6> originalFaces;
+        for (int k = 0; k < edges.size(); ++k) {
+            origNext[k] = derived().next(edges[k]);
+            origPrev[k] = derived().prev(edges[k]);
+            originalFaces[k] = derived().getFaceOfEdge(edges[k]);
+        }
+
+        backupInfo.emplace_back(edges, origNext, origPrev, originalFaces);
+    }
+    for (EdgeIndex edgeToMergeFrom : seedIndexToMergeFrom.second) {
+        std::array<EdgeIndex,6> edges = collectEdges(edgeToMergeFrom);
+
+        connectEdges(edges[0], edges[3]);
+        connectEdges(edges[2], edges[1]);
+
+        setFaces(newFaceIndex,{
+            edges[0], edges[1], edges[2], edges[3]
+        });
+        setFaces(invalidIndexValue, { edges[4], edgeToMergeFrom});
+
+        updateEdgeCount(numberOfEdges() - 2);
+    }
+    updatePolygonCount(numberOfPolygons() - 1);
+    return backupInfo;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline void HALF_EDGE_MESH_BASE_CLASS::rollbackMerge(const std::vector<ConnectivityBackupT>& backupInfo) {
+    for (const ConnectivityBackupT& edgeBackupInfo : backupInfo) {
+        for (int k = 0; k < edgeBackupInfo.edges.size(); ++k) {
+            derived().setNext(edgeBackupInfo.edges[k], edgeBackupInfo.next[k]);
+            derived().setPrev(edgeBackupInfo.edges[k], edgeBackupInfo.prev[k]);
+            derived().setFaceToEdge(edgeBackupInfo.faces[k], edgeBackupInfo.edges[k]);
+        }
+    }
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+inline bool HALF_EDGE_MESH_BASE_CLASS::isPolygonConvex(EdgeIndex firstEdgeOfPolygon) const {
+    Vertex v1 = derived().getVertex(derived().origin(firstEdgeOfPolygon));
+    Vertex v2 = derived().getVertex(target(firstEdgeOfPolygon));
+    Vertex v3 = derived().getVertex(target(derived().next(firstEdgeOfPolygon)));
+
+    bool positive = Vertex::orient2d(v1, v2, v3) > 0;
+
+    EdgeIndex currentEdge = derived().next(firstEdgeOfPolygon);
+    do {
+        v1 = v2;
+        v2 = v3;
+        currentEdge = derived().next(currentEdge);
+        v3 = derived().getVertex(target(currentEdge));
+
+        double cross = Vertex::orient2d(v1, v2, v3);
+        if (positive && cross <= 0) return false;
+        if (!positive && cross > 0) return false;
+
+    } while (currentEdge != firstEdgeOfPolygon);
+
+    return true;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+size_t HALF_EDGE_MESH_BASE_CLASS::constructInteriorHalfEdgeRecords(std::vector<FaceIndex> &faces) {
+    size_t n_faces = this->nPolygons;
+    derived().resizeHalfEdges(3 * n_faces);
+    parallel::forEach(0, n_faces, [&](size_t face) {
+        FaceIndex i = face;
+        for(FaceIndex j = 0; j < 3; ++j){
+            HalfEdgeT he {
+                .origin = faces[3*i+j],
+                .twin = -1,
+                .next = i*3+(j+1)%3,
+                .prev = i*3+(j+2)%3,
+                .face = i,
+                .isBorder = false
+            };
+            derived().setHalfEdge(i*3+j, he);
+        }
+        derived().setEdgeAsFace(i, i*3);
+    });
+    assignIncidentHalfEdges(faces);
+    return 3 * n_faces;
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+void HALF_EDGE_MESH_BASE_CLASS::assignIncidentHalfEdges(std::vector<FaceIndex> &faces) {
+    parallel::forEach(0, derived().getVertexVectorSize(), [&](size_t v) {
+        derived().getVertex(v).incidentHalfEdge = invalidIndexValue;
+    });
+    // Same result as assigning them in order, the highest edge leaving each vertex wins
+    parallel::forEach(0, 3 * this->nPolygons, [&](size_t e) {
+        std::atomic_ref<EdgeIndex> incident(derived().getVertex(faces[e]).incidentHalfEdge);
+        EdgeIndex edge = e;
+        EdgeIndex current = incident.load(std::memory_order_relaxed);
+        while (current < edge && !incident.compare_exchange_weak(current, edge, std::memory_order_relaxed)) {}
+    });
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+void HALF_EDGE_MESH_BASE_CLASS::constructInteriorHalfEdgesFromFacesAndNeighs(std::vector<FaceIndex> &faces, std::vector<FaceIndex> &neighbors) {
+    size_t n_faces = this->nPolygons;
+    size_t n_interior = 3 * n_faces;
+    std::vector<size_t> chunkBorderCounts(parallel::chunkCount(n_interior));
+    parallel::forEachChunk(0, n_interior, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+        chunkBorderCounts[chunk] = std::count(neighbors.begin() + chunkBegin, neighbors.begin() + chunkEnd, FaceIndex{-1});
+    });
+    size_t n_border = std::accumulate(chunkBorderCounts.begin(), chunkBorderCounts.end(), size_t{0});
+    // room for the exterior half edges too, so they don't reallocate the interior ones
+    derived().reserveHalfEdges(n_interior + n_border);
+    constructInteriorHalfEdgeRecords(faces);
+
+    std::vector<std::vector<EdgeIndex>> chunkBorderEdges(parallel::chunkCount(n_faces));
+    parallel::forEachChunk(0, n_faces, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+        for (size_t face = chunkBegin; face < chunkEnd; ++face) {
+            FaceIndex i = face;
+            for(FaceIndex j = 0; j < 3; ++j){
+                FaceIndex neigh = neighbors.at(3*i + ((j+2)%3));
+                if (neigh == -1) {
+                    chunkBorderEdges[chunk].push_back(3*i + j);
+                    continue;
+                }
+                VertexIndex origin = faces[3*i+j];
+                VertexIndex target = faces[3*i+((j+1)%3)];
+                for (FaceIndex k = 0; k < 3; ++k){
+                    if(faces.at(3*neigh + k) == target && faces.at(3*neigh + (k + 1)%3) == origin) {
+                        derived().setTwin(3*i + j, 3*neigh + k);
+                        break;
+                    }
+                }
+            }
+        }
+    });
+    for (const std::vector<EdgeIndex>& borderEdges : chunkBorderEdges) {
+        for (EdgeIndex edge : borderEdges) {
+            derived().setBorderEdge(edge, true);
+        }
+    }
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+void HALF_EDGE_MESH_BASE_CLASS::constructInteriorHalfEdgesFromFaces(std::vector<FaceIndex> &faces) {
+    constructInteriorHalfEdgeRecords(faces);
+    matchTwinsBySortedKeys(faces);
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+void HALF_EDGE_MESH_BASE_CLASS::matchTwinsBySortedKeys(std::vector<FaceIndex> &faces) {
+    struct TwinKey {
+        VertexIndex low;
+        VertexIndex high;
+        EdgeIndex edge;
+    };
+    size_t n_edges = 3 * this->nPolygons;
+    if (n_edges == 0) {
+        return;
+    }
+    std::vector<TwinKey> keys(n_edges);
+    parallel::forEach(0, n_edges, [&](size_t e) {
+        VertexIndex v_origin = faces[e];
+        VertexIndex v_target = faces[e - e % 3 + (e + 1) % 3];
+        keys[e] = TwinKey{std::min(v_origin, v_target), std::max(v_origin, v_target), static_cast<EdgeIndex>(e)};
+    });
+    std::uint64_t n_vertices = derived().getVertexVectorSize();
+    if (n_vertices <= (std::uint64_t{1} << 32)) {
+        auto combinedKey = [n_vertices](const TwinKey& key) {
+            return static_cast<std::uint64_t>(key.low) * n_vertices + static_cast<std::uint64_t>(key.high);
+        };
+        parallel::radixSort(keys, combinedKey, std::bit_width(n_vertices * n_vertices - 1));
+    } else {
+        // low * n_vertices + high no longer fits in 64 bits
+        std::sort(keys.begin(), keys.end(), [](const TwinKey& a, const TwinKey& b) {
+            return std::tie(a.low, a.high, a.edge) < std::tie(b.low, b.high, b.edge);
+        });
+    }
+
+    auto sameEdge = [&keys](size_t a, size_t b) {
+        return keys[a].low == keys[b].low && keys[a].high == keys[b].high;
+    };
+    // Each chunk pairs the keys of the groups that start inside it, the unpaired edges are labeled afterwards
+    // since flagging an edge or vertex as border isn't safe to do concurrently on every mesh type
+    std::vector<std::vector<EdgeIndex>> unpairedEdges(parallel::chunkCount(n_edges));
+    parallel::forEachChunk(0, n_edges, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+        size_t groupBegin = chunkBegin;
+        while (groupBegin < chunkEnd && groupBegin > 0 && sameEdge(groupBegin - 1, groupBegin)) {
+            ++groupBegin;
+        }
+        std::vector<EdgeIndex> forward;
+        std::vector<EdgeIndex> backward;
+        while (groupBegin < chunkEnd) {
+            size_t groupEnd = groupBegin + 1;
+            while (groupEnd < n_edges && sameEdge(groupBegin, groupEnd)) {
+                ++groupEnd;
+            }
+            forward.clear();
+            backward.clear();
+            for (size_t k = groupBegin; k < groupEnd; ++k) {
+                EdgeIndex edge = keys[k].edge;
+                if (faces[edge] == keys[k].low) {
+                    forward.push_back(edge);
+                } else {
+                    backward.push_back(edge);
+                }
+            }
+            size_t paired = std::min(forward.size(), backward.size());
+            for (size_t k = 0; k < paired; ++k) {
+                derived().setTwin(forward[k], backward[k]);
+                derived().setTwin(backward[k], forward[k]);
+            }
+            unpairedEdges[chunk].insert(unpairedEdges[chunk].end(), forward.begin() + paired, forward.end());
+            unpairedEdges[chunk].insert(unpairedEdges[chunk].end(), backward.begin() + paired, backward.end());
+            groupBegin = groupEnd;
+        }
+    });
+
+    for (const std::vector<EdgeIndex>& chunkEdges : unpairedEdges) {
+        for (EdgeIndex i : chunkEdges) {
+            derived().setBorderEdge(i, true);
+            derived().getVertex(derived().origin(i)).isBorder = true;
+            derived().getVertex(derived().origin(derived().next(i))).isBorder = true;
+        }
+    }
+}
+
+HALF_EDGE_MESH_BASE_TEMPLATE
+void HALF_EDGE_MESH_BASE_CLASS::constructExteriorHalfEdges() {
+    //search interior edges labed as border, generates exterior edges
+    //with the origin and target inverted and add at the of HalfEdges vector
+    EdgeIndex n_halfedges = derived().getEdgeVectorSize();
+    std::vector<std::vector<EdgeIndex>> chunkBorderEdges(parallel::chunkCount(n_halfedges));
+    parallel::forEachChunk(0, n_halfedges, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+        for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+            if (derived().isBorderEdge(i)) {
+                chunkBorderEdges[chunk].push_back(i);
+            }
+        }
+    });
+    size_t n_border = 0;
+    for (const std::vector<EdgeIndex>& borderEdges : chunkBorderEdges) {
+        n_border += borderEdges.size();
+    }
+    derived().reserveHalfEdges(n_halfedges + n_border);
+    for (const std::vector<EdgeIndex>& borderEdges : chunkBorderEdges) {
+        for (EdgeIndex i : borderEdges) {
+            HalfEdgeT he_aux{
+                .origin = derived().origin(derived().next(i)),
+                .twin = i,
+                .next = -1,
+                .prev = -1,
+                .face = -1,
+                .isBorder = true
+            };
+            derived().setBorderEdge(i, false);
+
+            derived().appendHalfEdge(he_aux);
+            derived().setTwin(i, derived().getEdgeVectorSize() - 1);
+        }
+    }
+    //link the exterior edges, the next of an exterior edge is the one leaving its target, which is unique
+    //unless the boundary touches itself at that vertex, only then the CCW walk around it is needed
+    size_t n_exterior = derived().getEdgeVectorSize() - n_halfedges;
+    std::vector<std::pair<VertexIndex, EdgeIndex>> exteriorByOrigin(n_exterior);
+    parallel::forEach(0, n_exterior, [&](size_t k) {
+        EdgeIndex edge = n_halfedges + k;
+        exteriorByOrigin[k] = {derived().origin(edge), edge};
+    });
+    std::uint64_t n_vertices = derived().getVertexVectorSize();
+    parallel::radixSort(exteriorByOrigin, [](const std::pair<VertexIndex, EdgeIndex>& entry) {
+        return static_cast<std::uint64_t>(entry.first);
+    }, std::bit_width(n_vertices));
+
+    std::vector<EdgeIndex> exteriorNext(n_exterior);
+    parallel::forEach(0, n_exterior, [&](size_t k) {
+        EdgeIndex edge = n_halfedges + k;
+        VertexIndex target = derived().origin(derived().twin(edge));
+        auto [first, last] = std::equal_range(exteriorByOrigin.begin(), exteriorByOrigin.end(), std::pair<VertexIndex, EdgeIndex>{target, 0},
+            [](const std::pair<VertexIndex, EdgeIndex>& a, const std::pair<VertexIndex, EdgeIndex>& b) {
+                return a.first < b.first;
+            });
+        if (std::distance(first, last) == 1) {
+            exteriorNext[k] = first->second;
+            return;
+        }
+        EdgeIndex nextCCW = CCWEdgeToVertex(derived().twin(edge));
+        while (derived().isBorderEdge(nextCCW) != true) {
+            nextCCW = CCWEdgeToVertex(nextCCW);
+        }
+        exteriorNext[k] = nextCCW;
+    });
+    for (size_t k = 0; k < n_exterior; ++k) {
+        derived().setNext(n_halfedges + k, exteriorNext[k]);
+        derived().setPrev(exteriorNext[k], n_halfedges + k);
+    }
+}
+
+#undef HALF_EDGE_MESH_BASE_CLASS
+#undef HALF_EDGE_MESH_BASE_TEMPLATE
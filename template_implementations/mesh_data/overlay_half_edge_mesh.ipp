@@ -0,0 +1,74 @@
+#ifndef OVERLAY_HALF_EDGE_MESH_HPP
+#include <mesh_data/overlay_half_edge_mesh.hpp>
+#endif
+
+#define OVERLAY_HALF_EDGE_MESH_TEMPLATE template <HalfEdgeMeshData BaseMesh>
+#define OVERLAY_HALF_EDGE_MESH_CLASS BasicOverlayHalfEdgeMesh<BaseMesh>
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+inline void OVERLAY_HALF_EDGE_MESH_CLASS::copyCountsFromBaseMesh() {
+    this->nVertices = baseMesh->numberOfVertices();
+    this->nHalfEdges = baseMesh->numberOfEdges();
+    this->nPolygons = baseMesh->numberOfPolygons();
+}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+OVERLAY_HALF_EDGE_MESH_CLASS::BasicOverlayHalfEdgeMesh(std::vector<VertexType> vertices,
+                                                       std::vector<EdgeType> edges,
+                                                       std::vector<FaceIndex> faces)
+    : baseMesh(std::make_shared<const BaseMesh>(std::move(vertices), std::move(edges), std::move(faces))) {
+    copyCountsFromBaseMesh();
+}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+OVERLAY_HALF_EDGE_MESH_CLASS::BasicOverlayHalfEdgeMesh(std::vector<VertexType> vertices,
+                                                       std::vector<EdgeType> edges,
+                                                       std::vector<FaceIndex> faces,
+                                                       std::vector<FaceIndex> neighbors) requires HasAdjacencyConstructor<BaseMesh>
+    : baseMesh(std::make_shared<const BaseMesh>(std::move(vertices), std::move(edges), std::move(faces), std::move(neighbors))) {
+    copyCountsFromBaseMesh();
+}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+OVERLAY_HALF_EDGE_MESH_CLASS::BasicOverlayHalfEdgeMesh(HalfEdgeMeshRecords<VertexType, EdgeType, FaceIndex> records) requires HasRecordsConstructor<BaseMesh>
+    : baseMesh(std::make_shared<const BaseMesh>(std::move(records))) {
+    copyCountsFromBaseMesh();
+}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+OVERLAY_HALF_EDGE_MESH_CLASS::BasicOverlayHalfEdgeMesh(const BasicOverlayHalfEdgeMesh& other)
+    : Base(other),
+      baseMesh(other.baseMesh),
+      ownsBaseMesh(false),
+      nextOverrides(other.nextOverrides),
+      prevOverrides(other.prevOverrides),
+      faceOverrides(other.faceOverrides),
+      polygonOverrides(other.polygonOverrides) {}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+OVERLAY_HALF_EDGE_MESH_CLASS& OVERLAY_HALF_EDGE_MESH_CLASS::operator=(const BasicOverlayHalfEdgeMesh& other) {
+    if (this != &other) {
+        Base::operator=(other);
+        baseMesh = other.baseMesh;
+        ownsBaseMesh = false;
+        nextOverrides = other.nextOverrides;
+        prevOverrides = other.prevOverrides;
+        faceOverrides = other.faceOverrides;
+        polygonOverrides = other.polygonOverrides;
+    }
+    return *this;
+}
+
+OVERLAY_HALF_EDGE_MESH_TEMPLATE
+inline typename OVERLAY_HALF_EDGE_MESH_CLASS::EdgeType OVERLAY_HALF_EDGE_MESH_CLASS::getEdge(EdgeIndex e) const {
+    EdgeType edge = baseMesh->getEdge(e);
+    edge.next = next(e);
+    edge.face = getFaceOfEdge(e);
+    if constexpr (requires { edge.prev; }) {
+        edge.prev = prev(e);
+    }
+    return edge;
+}
+
+#undef OVERLAY_HALF_EDGE_MESH_CLASS
+#undef OVERLAY_HALF_EDGE_MESH_TEMPLATE
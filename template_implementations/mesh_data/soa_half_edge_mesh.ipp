@@ -0,0 +1,116 @@
+#ifndef SOA_HALF_EDGE_MESH_HPP
+#include <mesh_data/soa_half_edge_mesh.hpp>
+#endif
+
+#define SOA_HALF_EDGE_MESH_TEMPLATE template <AccessPolicy Access>
+#define SOA_HALF_EDGE_MESH_CLASS BasicSoAHalfEdgeMesh<Access>
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::appendHalfEdge(const HalfEdge& he) {
+    EdgeIndex edge = origins.size();
+    origins.push_back(he.origin);
+    twins.push_back(he.twin);
+    nexts.push_back(he.next);
+    prevs.push_back(he.prev);
+    faces.push_back(he.face);
+    if (edge % bitsPerWord == 0) {
+        borderBits.push_back(0);
+    }
+    setBorderEdge(edge, he.isBorder);
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::setBorderEdge(EdgeIndex edge, bool isBorder) {
+    BitWord mask = BitWord{1} << (edge % bitsPerWord);
+    if (isBorder) {
+        Access::get(borderBits, edge / bitsPerWord) |= mask;
+    } else {
+        Access::get(borderBits, edge / bitsPerWord) &= ~mask;
+    }
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::reserveHalfEdges(size_t count) {
+    origins.reserve(count);
+    twins.reserve(count);
+    nexts.reserve(count);
+    prevs.reserve(count);
+    faces.reserve(count);
+    borderBits.reserve(count / bitsPerWord + 1);
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::resizeHalfEdges(size_t count) {
+    origins.resize(count);
+    twins.resize(count);
+    nexts.resize(count);
+    prevs.resize(count);
+    faces.resize(count);
+    borderBits.resize((count + bitsPerWord - 1) / bitsPerWord);
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::setHalfEdge(EdgeIndex edge, const HalfEdge& he) {
+    Access::get(origins, edge) = he.origin;
+    Access::get(twins, edge) = he.twin;
+    Access::get(nexts, edge) = he.next;
+    Access::get(prevs, edge) = he.prev;
+    Access::get(faces, edge) = he.face;
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline void SOA_HALF_EDGE_MESH_CLASS::shrinkHalfEdges() {
+    origins.shrink_to_fit();
+    twins.shrink_to_fit();
+    nexts.shrink_to_fit();
+    prevs.shrink_to_fit();
+    faces.shrink_to_fit();
+    borderBits.shrink_to_fit();
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+inline typename SOA_HALF_EDGE_MESH_CLASS::EdgeType SOA_HALF_EDGE_MESH_CLASS::getEdge(EdgeIndex e) const {
+    return HalfEdge{
+        .origin = origin(e),
+        .twin = twin(e),
+        .next = next(e),
+        .prev = prev(e),
+        .face = getFaceOfEdge(e),
+        .isBorder = isBorderEdge(e)
+    };
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+SOA_HALF_EDGE_MESH_CLASS::BasicSoAHalfEdgeMesh(std::vector<VertexType> vertices,
+                                               std::vector<EdgeType> edges,
+                                               std::vector<FaceIndex> faces) : vertices(vertices), polygons((faces.size() / 3)) {
+    this->nPolygons = faces.size() / 3;
+    reserveHalfEdges(3 * this->nPolygons);
+    for (const HalfEdge& he : edges) {
+        appendHalfEdge(he);
+    }
+    this->constructInteriorHalfEdgesFromFaces(faces);
+    this->constructExteriorHalfEdges();
+    shrinkHalfEdges();
+    this->nHalfEdges = origins.size();
+    this->nVertices = vertices.size();
+}
+
+SOA_HALF_EDGE_MESH_TEMPLATE
+SOA_HALF_EDGE_MESH_CLASS::BasicSoAHalfEdgeMesh(std::vector<VertexType> vertices,
+                                               std::vector<EdgeType> edges,
+                                               std::vector<FaceIndex> faces,
+                                               std::vector<FaceIndex> neighbors) : vertices(vertices), polygons((faces.size() / 3)) {
+    this->nPolygons = faces.size() / 3;
+    for (const HalfEdge& he : edges) {
+        appendHalfEdge(he);
+    }
+    this->constructInteriorHalfEdgesFromFacesAndNeighs(faces, neighbors);
+    this->constructExteriorHalfEdges();
+    shrinkHalfEdges();
+    this->nHalfEdges = origins.size();
+    this->nVertices = vertices.size();
+}
+
+#undef SOA_HALF_EDGE_MESH_CLASS
+#undef SOA_HALF_EDGE_MESH_TEMPLATE
@@ -6,112 +6,184 @@
 
 #define DELAUNAY_CAVITY_CLASS DelaunayCavityGenerator<MeshType,Criterion,Comparator,MergingStrategy>
 
+DELAUNAY_CAVITY_GENERATOR_TEMPLATE
+std::uint64_t DELAUNAY_CAVITY_CLASS::sortKey(const MeshType* outputMesh, FaceIndex triangle) const {
+    constexpr std::uint64_t notMatchingBit = std::uint64_t{1} << (sortKeyBits - 1);
+    std::uint64_t key = 0;
+    if constexpr (isRandomComparator<Comparator,MeshType>) {
+        key = comparator.randomBits(triangle) & (notMatchingBit - 1);
+    } else if constexpr (!isNullComparator<Comparator,MeshType>) {
+        // Comparator keys are non negative, so their bits read as an integer keep their order and leave the sign bit free.
+        // Adding 0.0 turns -0.0 into 0.0, which compare equal
+        double comparatorKey;
+        if constexpr (CachedTriangleComparator<Comparator,MeshType>) {
+            comparatorKey = Comparator::key(qualityCache, triangle);
+        } else {
+            comparatorKey = Comparator::key(outputMesh, triangle);
+        }
+        std::uint64_t bits = std::bit_cast<std::uint64_t>(comparatorKey + 0.0);
+        key = Comparator::ascending ? bits : ~bits & (notMatchingBit - 1);
+    }
+    if constexpr (!isNullSelectionCriterion<Criterion,MeshType>) {
+        key = matchesCriterion(outputMesh, triangle) ? 0 : key | notMatchingBit;
+    }
+    return key;
+}
+
 DELAUNAY_CAVITY_GENERATOR_TEMPLATE
 std::vector<typename MeshType::FaceIndex> DELAUNAY_CAVITY_CLASS::sortTriangles(MeshType *outputMesh) {
     
     std::vector<FaceIndex> triangles(outputMesh->numberOfPolygons());
     std::iota(triangles.begin(), triangles.end(), 0);
+    if constexpr (qualityMetrics != 0) {
+        qualityCache.compute<qualityMetrics>(outputMesh);
+    }
 
-    auto sortOrShuffle = [&](auto beginIt) {
-        if constexpr (!isNullComparator<Comparator,MeshType>) {
-            if constexpr (isRandomComparator<Comparator,MeshType>) {
-                std::shuffle(beginIt,triangles.end(), Comparator::generator);
-            } else {
-                std::stable_sort(beginIt, triangles.end(), [outputMesh](const FaceIndex& t1, const FaceIndex& t2) { 
-                    return Comparator::compare(outputMesh,t1,t2); 
-                });
-            }
-        }
-    };
-    if constexpr (isNullSelectionCriterion<Criterion,MeshType> && !isNullComparator<Comparator,MeshType>) {
-        sortOrShuffle(triangles.begin());
-    } else if constexpr (isNullComparator<Comparator,MeshType> && !isNullSelectionCriterion<Criterion,MeshType>) {
-        std::stable_partition(triangles.begin(), triangles.end(), [outputMesh, this](const FaceIndex& polygonIndex) { return selectionCriterion(outputMesh,polygonIndex);});
-    } else if constexpr (!isNullComparator<Comparator,MeshType> && !isNullSelectionCriterion<Criterion,MeshType>) {
-        auto iteratorToFirstNonMatching = std::stable_partition(triangles.begin(), triangles.end(), [outputMesh, this](const FaceIndex& polygonIndex) { return selectionCriterion(outputMesh,polygonIndex);});
-        sortOrShuffle(iteratorToFirstNonMatching);
+    if constexpr (!isNullComparator<Comparator,MeshType> || !isNullSelectionCriterion<Criterion,MeshType>) {
+        std::vector<std::pair<std::uint64_t, FaceIndex>> keyedTriangles(triangles.size());
+        parallel::forEach(0, triangles.size(), [&](size_t triangle) {
+            keyedTriangles[triangle] = {sortKey(outputMesh, triangle), static_cast<FaceIndex>(triangle)};
+        });
+        parallel::radixSort(keyedTriangles, [](const std::pair<std::uint64_t, FaceIndex>& keyed) {
+            return keyed.first;
+        }, sortKeyBits);
+        parallel::forEach(0, triangles.size(), [&](size_t i) {
+            triangles[i] = keyedTriangles[i].second;
+        });
     }
+    data.memoryStats[M_TRIANGLE_QUALITY_CACHE] = qualityCache.memoryUsage();
+    qualityCache = TriangleQualityCache();
     
     return triangles;
 }
 
 DELAUNAY_CAVITY_GENERATOR_TEMPLATE
-std::vector<generators::helpers::delaunay_cavity::Cavity<MeshType>> DELAUNAY_CAVITY_CLASS::computeCavities(const MeshType* inputMesh, const std::vector<FaceIndex>& sortedTriangles) {   
-    std::vector<_Cavity> cavities;
-    // Here we use a vector of uint8_t instead of a vector of bool for better performance at the cost of memory
-    std::vector<uint8_t> visited(inputMesh->numberOfPolygons(), 0);
-    cavities.reserve(sortedTriangles.size());
+void DELAUNAY_CAVITY_CLASS::loadTriangleBatch(const MeshType* inputMesh, const std::vector<FaceIndex>& triangles, incircle_batch::Batch& batch) {
+    batch.clear();
+    if constexpr (HalfEdgeMeshData<MeshType>) {
+        for (const FaceIndex triangle : triangles) {
+            EdgeIndex firstEdge = inputMesh->getPolygon(triangle);
+            incircle_batch::prefetch(std::addressof(inputMesh->getVertex(inputMesh->origin(firstEdge))));
+            incircle_batch::prefetch(std::addressof(inputMesh->getVertex(inputMesh->target(firstEdge))));
+            incircle_batch::prefetch(std::addressof(inputMesh->getVertex(inputMesh->target(inputMesh->next(firstEdge)))));
+        }
+    }
+    for (const FaceIndex triangle : triangles) {
+        Vertex v0, v1, v2;
+        inputMesh->getVerticesOfTriangle(triangle, v0, v1, v2);
+        batch.push(v0, v1, v2);
+    }
+}
+
+DELAUNAY_CAVITY_GENERATOR_TEMPLATE
+generators::helpers::delaunay_cavity::CavitySet<MeshType> DELAUNAY_CAVITY_CLASS::computeCavities(const MeshType* inputMesh, const std::vector<FaceIndex>& sortedTriangles) {   
+    _CavitySet cavities;
+    // Buffers of the level by level BFS, reused accross searches
+    std::vector<FaceIndex> level, nextLevel;
+    // For each neighbor reached from the level, in visiting order, its position in the incircle batch or `notTested` if it was already visited
+    constexpr size_t notTested = std::numeric_limits<size_t>::max();
+    std::vector<size_t> batchPosition;
+    std::vector<FaceIndex> batchTriangles;
+    std::vector<uint8_t> insideCircumcircle;
+    incircle_batch::Batch batch;
     for (const FaceIndex triangleOfCircumcenter : sortedTriangles) {
         if (data.inCavity[triangleOfCircumcenter]) continue;
-        Vertex seedV1,seedV2,seedV3;
-        inputMesh->getVerticesOfTriangle(triangleOfCircumcenter,seedV1,seedV2,seedV3);
-        Vertex circumcenter = Vertex::findCircumcenter(seedV1,seedV2,seedV3);
-        std::queue<FaceIndex> bfsNeighborVisitQueue;
+        Vertex circumcenter;
+        // A degenerate seed has no circumcircle to grow from, so it forms a cavity on its own
+        bool degenerateSeed = false;
+        if (precomputeCircumcircles) {
+            circumcenter = circumcircleTable.center(triangleOfCircumcenter);
+            degenerateSeed = circumcircleTable.degenerate[triangleOfCircumcenter];
+        } else {
+            Vertex seedV1,seedV2,seedV3;
+            inputMesh->getVerticesOfTriangle(triangleOfCircumcenter,seedV1,seedV2,seedV3);
+            circumcenter = Vertex::findCircumcenter(seedV1,seedV2,seedV3);
+        }
         cavities.emplace_back();
+        // Triangles stamped with the number of the cavity being computed are the ones this search already visited
+        const CavityStamp stamp = cavities.size();
 
-        _Cavity& cavity = cavities.back();
-
-        bfsNeighborVisitQueue.push(triangleOfCircumcenter);
+        level.assign(1, triangleOfCircumcenter);
 
-        visited[triangleOfCircumcenter] = 1;
+        data.inCavity[triangleOfCircumcenter] = stamp;
 
-        cavity.allTriangles.push_back(triangleOfCircumcenter);
-        while(!bfsNeighborVisitQueue.empty()) {
-            FaceIndex currentTriangle = bfsNeighborVisitQueue.front();
-            data.inCavity[currentTriangle] = true;
-            bfsNeighborVisitQueue.pop();
-            const std::vector<FaceIndex>& neighbors = inputMesh->getNeighbors(currentTriangle);
-            std::array<EdgeIndex, 3> triangleEdges = inputMesh->getEdgesOfTriangle(currentTriangle);
-            bool isBoundary = false;
-
-            if (neighbors.size() < 3) {
-                for (EdgeIndex e : triangleEdges) {
-                    if (_MeshHelper::isBorderEdge(inputMesh,e)) {
-                        isBoundary = currentTriangle != triangleOfCircumcenter;
-                        cavity.boundaryEdges.push_back(e);
+        cavities.addTriangle(triangleOfCircumcenter);
+        while(!level.empty()) {
+            // Triangles already visited when the level starts can't be added by it, the rest are tested all at once
+            batchPosition.clear();
+            batchTriangles.clear();
+            for (const FaceIndex currentTriangle : level) {
+                for (auto [edge, neighbor] : inputMesh->facesAround(currentTriangle)) {
+                    if (neighbor == MeshType::invalidIndexValue) continue;
+                    if (data.inCavity[neighbor] == stamp) {
+                        batchPosition.push_back(notTested);
+                    } else {
+                        batchPosition.push_back(batchTriangles.size());
+                        batchTriangles.push_back(neighbor);
                     }
                 }
             }
-            for (FaceIndex neighbor : neighbors) {
-                if (visited[neighbor]) continue;
-                bool validNeighbor = true;
-                if constexpr (HasPreAddMethodPerCavity<MergingStrategy,MeshType>) {
-                    validNeighbor = MergingStrategy::preAdd(inputMesh,neighbor,cavities);
+            if (precomputeCircumcircles) {
+                insideCircumcircle.resize(batchTriangles.size());
+                for (size_t i = 0; i < batchTriangles.size(); ++i) {
+                    uint8_t inside = degenerateSeed ? static_cast<uint8_t>(incircle_batch::OUTSIDE) : circumcircleTable.classify(batchTriangles[i], circumcenter);
+                    if (inside == incircle_batch::UNDECIDED) {
+                        Vertex v0, v1, v2;
+                        inputMesh->getVerticesOfTriangle(batchTriangles[i], v0, v1, v2);
+                        inside = Vertex::inCircle(v0, v1, v2, circumcenter) ? incircle_batch::INSIDE : incircle_batch::OUTSIDE;
+                    }
+                    insideCircumcircle[i] = inside;
                 }
-                if constexpr (HasPreAddMethodByPresence<MergingStrategy,MeshType>) {
-                    validNeighbor = MergingStrategy::preAdd(neighbor,data.inCavity);
+            } else {
+                loadTriangleBatch(inputMesh, batchTriangles, batch);
+                incircle_batch::inCircle(batch, circumcenter, insideCircumcircle);
+            }
+
+            nextLevel.clear();
+            size_t reachedNeighbor = 0;
+            for (const FaceIndex currentTriangle : level) {
+                bool isBoundary = false;
+                // Edges on the border of the mesh go first, then the ones crossed to reach neighbors outside the cavity
+                for (auto [edge, neighbor] : inputMesh->facesAround(currentTriangle)) {
+                    if (neighbor == MeshType::invalidIndexValue) {
+                        isBoundary = currentTriangle != triangleOfCircumcenter;
+                        cavities.addBoundaryEdge(edge);
+                    }
                 }
-                Vertex v0, v1, v2;
-                inputMesh->getVerticesOfTriangle(neighbor, v0, v1, v2);
-                
-                if (validNeighbor && Vertex::inCircle(v0, v1, v2, circumcenter)) {
-                    visited[neighbor] = 1;
-                    bfsNeighborVisitQueue.push(neighbor);
-                    cavity.allTriangles.push_back(neighbor);
-                } else if (currentTriangle == triangleOfCircumcenter) {
-                    for (EdgeIndex e : triangleEdges) {
-                        if (_MeshHelper::isSharedTriangleEdge(inputMesh,e,currentTriangle,neighbor)) {
-                            cavity.boundaryEdges.push_back(e);
-                        }
+                for (auto [edge, neighbor] : inputMesh->facesAround(currentTriangle)) {
+                    if (neighbor == MeshType::invalidIndexValue) continue;
+                    size_t position = batchPosition[reachedNeighbor++];
+                    if (data.inCavity[neighbor] == stamp) continue;
+                    bool validNeighbor = true;
+                    if constexpr (HasPreAddMethodPerCavity<MergingStrategy,MeshType>) {
+                        validNeighbor = MergingStrategy::preAdd(inputMesh,neighbor,cavities);
+                    }
+                    if constexpr (HasPreAddMethodByPresence<MergingStrategy,MeshType>) {
+                        validNeighbor = MergingStrategy::preAdd(neighbor,data.inCavity);
                     }
-                } else {
-                    isBoundary = true;
 
-                    EdgeIndex boundaryEdge = inputMesh->getTriangleSharedEdge(currentTriangle,neighbor);
-                    cavity.boundaryEdges.push_back(boundaryEdge);
+                    if (validNeighbor && insideCircumcircle[position]) {
+                        data.inCavity[neighbor] = stamp;
+                        nextLevel.push_back(neighbor);
+                        cavities.addTriangle(neighbor);
+                    } else {
+                        if (currentTriangle != triangleOfCircumcenter) {
+                            isBoundary = true;
+                        }
+                        cavities.addBoundaryEdge(edge);
+                    }
                 }
-            }
 
-            if (isBoundary) {
-                cavity.boundaryTriangles.push_back(currentTriangle);
-            } else {
-                cavity.interior.push_back(currentTriangle);
+                if (isBoundary) {
+                    cavities.addBoundaryTriangle(currentTriangle);
+                } else {
+                    cavities.addInterior(currentTriangle);
+                }
             }
+            level.swap(nextLevel);
         }
-
-        resetVisited(visited, cavity);
     }
-    data.memoryStats[M_VISITED_ARRAY] = sizeof(decltype(visited.back())) * visited.capacity();
+    data.memoryStats[M_VISITED_ARRAY] = sizeof(CavityStamp) * data.inCavity.capacity();
     return cavities;
 }
 
@@ -119,20 +191,32 @@ DELAUNAY_CAVITY_GENERATOR_TEMPLATE
 MeshType* DELAUNAY_CAVITY_CLASS::generateMesh(const MeshType* inputMesh) {
     MeshType* outputMesh = new MeshType(*inputMesh);
     size_t polygonAmount = outputMesh->numberOfPolygons();
-    data.inCavity = std::vector<uint8_t>(polygonAmount, 0);
+    data.inCavity = std::vector<CavityStamp>(polygonAmount, 0);
     auto startTime = std::chrono::high_resolution_clock::now();
     std::vector<FaceIndex> sortedTriangles = sortTriangles(outputMesh);
     auto endTime = std::chrono::high_resolution_clock::now();
     data.timeStats[T_TRIANGLE_SORTING] = std::chrono::duration<double, std::milli>(endTime-startTime).count();
+    if (precomputeCircumcircles) {
+        startTime = std::chrono::high_resolution_clock::now();
+        circumcircleTable.compute(outputMesh);
+        endTime = std::chrono::high_resolution_clock::now();
+        data.timeStats[T_CIRCUMCENTER_COMPUTATION] = std::chrono::duration<double, std::milli>(endTime-startTime).count();
+        data.memoryStats[M_CIRCUMCIRCLE_TABLE] = circumcircleTable.memoryUsage();
+    }
     startTime = std::chrono::high_resolution_clock::now();
-    std::vector<_Cavity> cavities = computeCavities(outputMesh, sortedTriangles);
+    _CavitySet cavities = computeCavities(outputMesh, sortedTriangles);
+    circumcircleTable = _CircumcircleTable();
     if constexpr (HasPostComputeMethod<MergingStrategy,MeshType>) {
         MergingStrategy::postCompute(outputMesh,cavities);
     }
     endTime = std::chrono::high_resolution_clock::now();
     data.timeStats[T_CAVITY_COMPUTATION] = std::chrono::duration<double, std::milli>(endTime-startTime).count();
     startTime = std::chrono::high_resolution_clock::now();
-    data.outputSeeds = _MeshHelper::insertCavity(inputMesh, outputMesh, cavities, data.inCavity);
+    if constexpr (HasDisjointCavities<MergingStrategy, MeshType> && hasConcurrentLinkUpdates<MeshType>) {
+        data.outputSeeds = _MeshHelper::insertDisjointCavities(inputMesh, outputMesh, cavities, data.inCavity);
+    } else {
+        data.outputSeeds = _MeshHelper::insertCavity(inputMesh, outputMesh, cavities, data.inCavity);
+    }
     endTime = std::chrono::high_resolution_clock::now();
     data.timeStats[T_CAVITY_INSERTION] = std::chrono::duration<double, std::milli>(endTime-startTime).count();
     if constexpr (HasPostInsertionMethod<MergingStrategy, MeshType>) {
@@ -149,7 +233,7 @@ MeshType* DELAUNAY_CAVITY_CLASS::generateMesh(const MeshType* inputMesh) {
     data.meshStats[N_POLYGONS] = data.outputSeeds.size();
     data.meshStats[N_VERTICES] = outputMesh->numberOfVertices();
     data.meshStats[N_EDGES] = outputMesh->numberOfEdges();
-    data.memoryStats[M_CAVITY_ARRAY] = sizeof(decltype(cavities.back())) * cavities.capacity();
+    data.memoryStats[M_CAVITY_ARRAY] = cavities.memoryUsage();
     data.memoryStats[M_VERTICES_INPUT] = inputMesh->getVertexMemoryUsage();
     data.memoryStats[M_EDGES_INPUT] = inputMesh->getEdgesMemoryUsage();
     data.memoryStats[M_VERTICES_OUTPUT] = outputMesh->getVertexMemoryUsage();
@@ -4,7 +4,8 @@
 
 namespace generators::helpers::delaunay_cavity {
     
-    std::vector<HalfEdgeMesh::EdgeIndex> MeshHelper<HalfEdgeMesh>::generateInitialOutputSeeds(HalfEdgeMesh* mesh) {
+    template <HalfEdgeMeshData MeshType>
+    std::vector<typename MeshHelper<MeshType>::OutputIndex> MeshHelper<MeshType>::generateInitialOutputSeeds(MeshType* mesh) {
         size_t polygonAmount = mesh->numberOfPolygons();
         std::vector<EdgeIndex> incidentHalfEdges;
         incidentHalfEdges.reserve(polygonAmount);
@@ -14,27 +15,56 @@ namespace generators::helpers::delaunay_cavity {
         return incidentHalfEdges;
     }
 
-    bool MeshHelper<HalfEdgeMesh>::isBorderEdge(const HalfEdgeMesh* mesh, EdgeIndex e) {
+    template <HalfEdgeMeshData MeshType>
+    bool MeshHelper<MeshType>::isBorderEdge(const MeshType* mesh, EdgeIndex e) {
         return mesh->isBorderEdge(e) || mesh->isBorderEdge(mesh->twin(e));
     }
 
-    bool MeshHelper<HalfEdgeMesh>::isSharedTriangleEdge(const HalfEdgeMesh* mesh, EdgeIndex edge, FaceIndex triangle1, FaceIndex triangle2) {
-        EdgeIndex candidate1 = mesh->getTriangleSharedEdge(triangle1,triangle2);
-        EdgeIndex candidate2 = mesh->twin(candidate1);
-        return edge == candidate1 || edge == candidate2;
-    }
-
-    std::array<HalfEdgeMesh::EdgeIndex,3> MeshHelper<HalfEdgeMesh>::getTriangleEdges(HalfEdgeMesh* outputMesh, FaceIndex triangle) {
+    template <HalfEdgeMeshData MeshType>
+    std::array<typename MeshHelper<MeshType>::EdgeIndex,3> MeshHelper<MeshType>::getTriangleEdges(MeshType* outputMesh, FaceIndex triangle) {
         EdgeIndex edge1 = outputMesh->getPolygon(triangle);
         EdgeIndex edge2 = outputMesh->next(edge1);
         EdgeIndex edge3 = outputMesh->next(edge2);
         return {edge1, edge2, edge3};
     }
 
-    std::vector<HalfEdgeMesh::OutputIndex> MeshHelper<HalfEdgeMesh>::insertCavity(const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, std::vector<_Cavity>& cavities, const std::vector<uint8_t>& inCavity) {
+    template <HalfEdgeMeshData MeshType>
+    void MeshHelper<MeshType>::relinkCavity(const MeshType* inputMesh, MeshType* outputMesh, const _Cavity& cavity, std::vector<uint8_t>& presentInBoundary, std::vector<std::pair<VertexIndex, EdgeIndex>>& outgoingEdges) {
+        std::span<const EdgeIndex> boundaryEdges = cavity.boundaryEdges;
+        EdgeIndex firstEdge = boundaryEdges.front();
+        outgoingEdges.clear();
+        for (EdgeIndex boundaryEdge : boundaryEdges) {
+            presentInBoundary[boundaryEdge] = 1;
+            outgoingEdges.emplace_back(inputMesh->origin(boundaryEdge), boundaryEdge);
+        }
+        std::sort(outgoingEdges.begin(), outgoingEdges.end());
+        EdgeIndex currentEdge = firstEdge;
+        do {
+            VertexIndex vertex = inputMesh->target(currentEdge);
+            auto outgoing = std::ranges::lower_bound(outgoingEdges, vertex, {}, &std::pair<VertexIndex, EdgeIndex>::first);
+            EdgeIndex nextEdge = outgoing->second;
+            // A cavity that touches itself at `vertex` leaves it through more than one edge, the loop continues through the first one CCW
+            if (std::next(outgoing) != outgoingEdges.end() && std::next(outgoing)->first == vertex) {
+                nextEdge = inputMesh->next(currentEdge);
+                while (!presentInBoundary[nextEdge]) {
+                    nextEdge = inputMesh->CCWEdgeToVertex(nextEdge);
+                }
+            }
+            outputMesh->setNext(currentEdge,nextEdge);
+            outputMesh->setPrev(nextEdge, currentEdge);
+            currentEdge = nextEdge;
+        } while( currentEdge != firstEdge);
+        for (EdgeIndex boundaryEdge : boundaryEdges) {
+            presentInBoundary[boundaryEdge] = 0;
+        }
+    }
+
+    template <HalfEdgeMeshData MeshType>
+    std::vector<typename MeshHelper<MeshType>::OutputIndex> MeshHelper<MeshType>::insertCavity(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity) {
         size_t faceCount = outputMesh->numberOfPolygons();
         size_t edgeCount = outputMesh->numberOfEdges();
         std::vector<uint8_t> presentInBoundary(edgeCount);
+        std::vector<std::pair<VertexIndex, EdgeIndex>> outgoingEdges;
         std::vector<OutputIndex> outputSeeds;
         outputSeeds.reserve(faceCount);
         for (FaceIndex face = 0; face < faceCount; ++face) {
@@ -43,36 +73,71 @@ namespace generators::helpers::delaunay_cavity {
                 outputSeeds.push_back(incidentHE);
             }
         }
-        for (const _Cavity& cavity : cavities) {
-            const std::vector<EdgeIndex>& boundaryEdges = cavity.boundaryEdges;
-            EdgeIndex firstEdge = boundaryEdges.front();
-            outputSeeds.push_back(firstEdge);
+        for (size_t i = 0; i < cavities.size(); ++i) {
+            _Cavity cavity = cavities[i];
+            outputSeeds.push_back(cavity.boundaryEdges.front());
             if (cavity.allTriangles.size() == 1) { 
                 continue;
             }
             faceCount -= (cavity.allTriangles.size() - 1);
-            edgeCount -= (cavity.allTriangles.size() * 3) - boundaryEdges.size();
-            std::fill(presentInBoundary.begin(), presentInBoundary.end(), 0);
-            for (EdgeIndex boundaryEdge : boundaryEdges) {
-                presentInBoundary[boundaryEdge] = 1;
-            }
-            EdgeIndex currentEdge = firstEdge;
-            do {
-                EdgeIndex nextEdge = inputMesh->next(currentEdge);
-                while (!presentInBoundary[nextEdge]) {
-                    nextEdge = inputMesh->CCWEdgeToVertex(nextEdge);
-                }
-                outputMesh->setNext(currentEdge,nextEdge);
-                outputMesh->setPrev(nextEdge, currentEdge);
-                currentEdge = nextEdge;
-            } while( currentEdge != firstEdge);
+            edgeCount -= (cavity.allTriangles.size() * 3) - cavity.boundaryEdges.size();
+            relinkCavity(inputMesh, outputMesh, cavity, presentInBoundary, outgoingEdges);
         }
         outputMesh->updateEdgeCount(edgeCount);
         outputMesh->updatePolygonCount(faceCount);
         return outputSeeds;
     }
-    inline UnionFindCavityMerger<HalfEdgeMesh> MeshHelper<HalfEdgeMesh>::buildEdgeToOutputMap(HalfEdgeMesh *outputMesh, const std::vector<OutputIndex> &outputSeeds) {
-        UnionFindCavityMerger<HalfEdgeMesh> edgeMap(outputMesh->getEdgeVectorSize());
+
+    template <HalfEdgeMeshData MeshType>
+    std::vector<typename MeshHelper<MeshType>::OutputIndex> MeshHelper<MeshType>::insertDisjointCavities(const MeshType* inputMesh, MeshType* outputMesh, const _CavitySet& cavities, const std::vector<typename DelaunayCavityData<MeshType>::CavityStamp>& inCavity) {
+        size_t faceCount = outputMesh->numberOfPolygons();
+        size_t edgeCount = outputMesh->numberOfEdges();
+        std::vector<uint8_t> presentInBoundary(edgeCount);
+        // Each chunk of faces writes the seeds of its triangles outside every cavity after the ones of the chunks before it
+        std::vector<size_t> chunkSeeds(parallel::chunkCount(faceCount) + 1, 0);
+        parallel::forEachChunk(0, faceCount, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            chunkSeeds[chunk + 1] = std::count(inCavity.begin() + chunkBegin, inCavity.begin() + chunkEnd, 0);
+        });
+        for (size_t chunk = 1; chunk < chunkSeeds.size(); ++chunk) {
+            chunkSeeds[chunk] += chunkSeeds[chunk - 1];
+        }
+        size_t triangleSeeds = chunkSeeds.back();
+        std::vector<OutputIndex> outputSeeds(triangleSeeds + cavities.size());
+        parallel::forEachChunk(0, faceCount, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            size_t nextSeed = chunkSeeds[chunk];
+            for (size_t face = chunkBegin; face < chunkEnd; ++face) {
+                if (!inCavity[face]) {
+                    outputSeeds[nextSeed++] = inputMesh->getPolygon(face);
+                }
+            }
+        });
+        // The boundary edges relinked for a cavity belong to its own triangles, so no other cavity reads or writes them
+        std::vector<size_t> removedFaces(parallel::chunkCount(cavities.size()), 0);
+        std::vector<size_t> removedEdges(removedFaces.size(), 0);
+        parallel::forEachChunk(0, cavities.size(), [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            std::vector<std::pair<VertexIndex, EdgeIndex>> outgoingEdges;
+            size_t chunkFaces = 0;
+            size_t chunkEdges = 0;
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                _Cavity cavity = cavities[i];
+                outputSeeds[triangleSeeds + i] = cavity.boundaryEdges.front();
+                if (cavity.allTriangles.size() == 1) {
+                    continue;
+                }
+                chunkFaces += cavity.allTriangles.size() - 1;
+                chunkEdges += (cavity.allTriangles.size() * 3) - cavity.boundaryEdges.size();
+                relinkCavity(inputMesh, outputMesh, cavity, presentInBoundary, outgoingEdges);
+            }
+            removedFaces[chunk] = chunkFaces;
+            removedEdges[chunk] = chunkEdges;
+        });
+        outputMesh->updateEdgeCount(edgeCount - std::accumulate(removedEdges.begin(), removedEdges.end(), size_t{0}));
+        outputMesh->updatePolygonCount(faceCount - std::accumulate(removedFaces.begin(), removedFaces.end(), size_t{0}));
+        return outputSeeds;
+    }
+    template <HalfEdgeMeshData MeshType>
+    inline UnionFindCavityMerger<MeshType> MeshHelper<MeshType>::buildEdgeToOutputMap(MeshType *outputMesh, const std::vector<OutputIndex> &outputSeeds) {
+        UnionFindCavityMerger<MeshType> edgeMap(outputMesh->getEdgeVectorSize());
         for (OutputIndex seed : outputSeeds) {
             EdgeIndex currentEdge = seed;
             do {
@@ -82,7 +147,8 @@ namespace generators::helpers::delaunay_cavity {
         }
         return edgeMap;
     }
-    inline HalfEdgeMesh::OutputIndex MeshHelper<HalfEdgeMesh>::changeToValidRepresentative(HalfEdgeMesh *outputMesh, UnionFindCavityMerger<HalfEdgeMesh> &edgeToOutputMap, std::vector<EdgeIndex> invalidEdges, OutputIndex currentRepresentaive) {
+    template <HalfEdgeMeshData MeshType>
+    inline typename MeshHelper<MeshType>::OutputIndex MeshHelper<MeshType>::changeToValidRepresentative(MeshType *outputMesh, UnionFindCavityMerger<MeshType> &edgeToOutputMap, std::vector<EdgeIndex> invalidEdges, OutputIndex currentRepresentaive) {
         EdgeIndex newRepresentative = currentRepresentaive;
         std::vector<EdgeIndex> twins;
         twins.reserve(invalidEdges.size());
@@ -115,8 +181,9 @@ namespace generators::helpers::delaunay_cavity {
         return newRepresentative;
     }
 
-    template <PolygonMergingPolicy<HalfEdgeMesh> MergingPolicy>
-    void MeshHelper<HalfEdgeMesh>::mergeIntoNeighbor(const HalfEdgeMesh *inputMesh, HalfEdgeMesh *outputMesh, std::vector<OutputIndex> &outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<HalfEdgeMesh>& edgeToOutputMap) {
+    template <HalfEdgeMeshData MeshType>
+    template <PolygonMergingPolicy<MeshType> MergingPolicy>
+    void MeshHelper<MeshType>::mergeIntoNeighbor(const MeshType *inputMesh, MeshType *outputMesh, std::vector<OutputIndex> &outputSeeds, OutputIndex seedToMerge, UnionFindCavityMerger<MeshType>& edgeToOutputMap, [[maybe_unused]] const EdgeLengthCache<MeshType>& edgeLengths) {
 
         std::vector<OutputIndex> neighborSeeds;
         std::vector<std::vector<EdgeIndex>> sharedEdges;
@@ -139,9 +206,14 @@ namespace generators::helpers::delaunay_cavity {
             currentEdge = outputMesh->next(currentEdge);
         } while (currentEdge != seedToMerge);
         
-        OutputIndex chosenNeighbor = MergingPolicy::mergeBestCandidate(outputMesh, seedToMerge, neighborSeeds, sharedEdges);
-        if (chosenNeighbor != HalfEdgeMesh::invalidIndexValue) {
-            std::replace(outputSeeds.begin(), outputSeeds.end(), seedToMerge, HalfEdgeMesh::invalidIndexValue);
+        OutputIndex chosenNeighbor;
+        if constexpr (EdgeLengthMergingPolicy<MergingPolicy,MeshType>) {
+            chosenNeighbor = MergingPolicy::mergeBestCandidate(outputMesh, edgeLengths, seedToMerge, neighborSeeds, sharedEdges);
+        } else {
+            chosenNeighbor = MergingPolicy::mergeBestCandidate(outputMesh, seedToMerge, neighborSeeds, sharedEdges);
+        }
+        if (chosenNeighbor != MeshType::invalidIndexValue) {
+            std::replace(outputSeeds.begin(), outputSeeds.end(), seedToMerge, MeshType::invalidIndexValue);
             currentEdge = chosenNeighbor;
             do {
                 edgeToOutputMap.unite(currentEdge, chosenNeighbor);
@@ -3,19 +3,26 @@
 #endif
 
 namespace generators::helpers::polylla {
-    void MeshHelper<HalfEdgeMesh>::labelMaxEdges(GeneratorData& data, HalfEdgeMesh* mesh) {
-        for(FaceIndex face = 0; face < mesh->numberOfPolygons(); ++face) {
-            data.maxEdges[findMaxEdge(mesh,face)] = true;
-        }
+    template <HalfEdgeMeshData MeshType>
+    void MeshHelper<MeshType>::labelMaxEdges(GeneratorData& data, MeshType* mesh) {
+        // Every interior edge is shared by two triangles, so its length is computed once here instead of once per triangle
+        EdgeLengthCache<MeshType> edgeLengths;
+        edgeLengths.compute(mesh);
+        // The max edge of a face is one of its own half edges, so each face writes a different entry
+        parallel::forEach(0, mesh->numberOfPolygons(), [&](size_t face) {
+            data.maxEdges[findMaxEdge(mesh,edgeLengths,face)] = true;
+        });
+        data.memoryStats[M_EDGE_LENGTH_CACHE] = edgeLengths.memoryUsage();
     }
 
-    HalfEdgeMesh::EdgeIndex MeshHelper<HalfEdgeMesh>::findMaxEdge(HalfEdgeMesh* mesh, FaceIndex face) {
+    template <HalfEdgeMeshData MeshType>
+    typename MeshHelper<MeshType>::EdgeIndex MeshHelper<MeshType>::findMaxEdge(MeshType* mesh, const EdgeLengthCache<MeshType>& edgeLengths, FaceIndex face) {
         EdgeIndex incidentHalfEdge = mesh->getPolygon(face);
         EdgeIndex nextEdge = mesh->next(incidentHalfEdge);
         EdgeIndex prevEdge = mesh->prev(incidentHalfEdge);
-        double dist0 = mesh->edgeLength2(incidentHalfEdge);
-        double dist1 = mesh->edgeLength2(nextEdge);
-        double dist2 = mesh->edgeLength2(prevEdge);
+        double dist0 = edgeLengths[incidentHalfEdge];
+        double dist1 = edgeLengths[nextEdge];
+        double dist2 = edgeLengths[prevEdge];
         double maxLength = std::max({dist0, dist1, dist2});
         //Find the longest edge of the triangle
         if(maxLength == dist0) {
@@ -26,7 +33,8 @@ namespace generators::helpers::polylla {
             return prevEdge;
         }
     }
-    void MeshHelper<HalfEdgeMesh>::labelFrontierEdges(GeneratorData& data, HalfEdgeMesh *mesh) {
+    template <HalfEdgeMeshData MeshType>
+    void MeshHelper<MeshType>::labelFrontierEdges(GeneratorData& data, MeshType *mesh) {
         for (EdgeIndex edge = 0; edge < mesh->numberOfEdges(); ++edge){
             if(isFrontierEdge(data, mesh, edge)){
                 data.frontierEdges[edge] = true;
@@ -35,13 +43,15 @@ namespace generators::helpers::polylla {
         }
     }
 
-    bool MeshHelper<HalfEdgeMesh>::isFrontierEdge(GeneratorData& data, HalfEdgeMesh *mesh, EdgeIndex edge) {
+    template <HalfEdgeMeshData MeshType>
+    bool MeshHelper<MeshType>::isFrontierEdge(GeneratorData& data, MeshType *mesh, EdgeIndex edge) {
         EdgeIndex twin = mesh->twin(edge);
         bool isBorderEdge = mesh->isBorderEdge(edge) || mesh->isBorderEdge(twin);
         bool isMaxEdge = data.maxEdges[edge] || data.maxEdges[twin];
         return isBorderEdge || !isMaxEdge;
     }
-    std::vector<HalfEdgeMesh::OutputIndex> MeshHelper<HalfEdgeMesh>::generateSeedCandidates(GeneratorData& data, HalfEdgeMesh *mesh) {
+    template <HalfEdgeMeshData MeshType>
+    std::vector<typename MeshHelper<MeshType>::OutputIndex> MeshHelper<MeshType>::generateSeedCandidates(GeneratorData& data, MeshType *mesh) {
         std::vector<OutputIndex> seedCandidates;
         for (EdgeIndex edge = 0; edge < mesh->numberOfEdges(); ++edge) {
             if(!mesh->isBorderEdge(edge) && isSeedCandidateIndex(data,mesh,edge)) {
@@ -50,7 +60,8 @@ namespace generators::helpers::polylla {
         }
         return seedCandidates;
     }
-    bool MeshHelper<HalfEdgeMesh>::isSeedCandidateIndex(GeneratorData& data, HalfEdgeMesh *mesh, OutputIndex seedCandidate) {
+    template <HalfEdgeMeshData MeshType>
+    bool MeshHelper<MeshType>::isSeedCandidateIndex(GeneratorData& data, MeshType *mesh, OutputIndex seedCandidate) {
         EdgeIndex candidateTwin = mesh->twin(seedCandidate);
 
         bool isTerminalEdge = (!mesh->isBorderEdge(candidateTwin) && (data.maxEdges[seedCandidate] && data.maxEdges[candidateTwin]));
@@ -62,7 +73,8 @@ namespace generators::helpers::polylla {
 
         return false;
     }
-    std::vector<HalfEdgeMesh::OutputIndex> MeshHelper<HalfEdgeMesh>::generateOutputSeeds(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh) {
+    template <HalfEdgeMeshData MeshType>
+    std::vector<typename MeshHelper<MeshType>::OutputIndex> MeshHelper<MeshType>::generateOutputSeeds(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh) {
         //Travel phase: Generate polygon mesh
         std::vector<OutputIndex> outputSeeds;
         EdgeIndex polygonSeed;
@@ -91,7 +103,8 @@ namespace generators::helpers::polylla {
         return outputSeeds;
     }
 
-    HalfEdgeMesh::OutputIndex MeshHelper<HalfEdgeMesh>::generatePolygonFromSeed(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex seed) {
+    template <HalfEdgeMeshData MeshType>
+    typename MeshHelper<MeshType>::OutputIndex MeshHelper<MeshType>::generatePolygonFromSeed(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex seed) {
         //search next frontier-edge
         EdgeIndex firstEdge = getNextFrontierEdge(data, inputMesh,seed);
         EdgeIndex currentEdge = inputMesh->next(firstEdge);
@@ -112,14 +125,16 @@ namespace generators::helpers::polylla {
 
         return firstEdge;
     }
-    HalfEdgeMesh::EdgeIndex MeshHelper<HalfEdgeMesh>::getNextFrontierEdge(GeneratorData& data, const HalfEdgeMesh *mesh, EdgeIndex edge) {
+    template <HalfEdgeMeshData MeshType>
+    typename MeshHelper<MeshType>::EdgeIndex MeshHelper<MeshType>::getNextFrontierEdge(GeneratorData& data, const MeshType *mesh, EdgeIndex edge) {
         EdgeIndex nextEdge = edge;
         while(!data.frontierEdges[nextEdge]) {
             nextEdge = mesh->CWEdgeToVertex(nextEdge);
         }
         return nextEdge;
     }
-    void MeshHelper<HalfEdgeMesh>::barrierEdgeTipReparation(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex nonSimpleSeed, std::vector<OutputIndex>& currentOutputs) {
+    template <HalfEdgeMeshData MeshType>
+    void MeshHelper<MeshType>::barrierEdgeTipReparation(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex nonSimpleSeed, std::vector<OutputIndex>& currentOutputs) {
         ++data.polygonToRepairAccumulator;
         std::vector<EdgeIndex> triangleList;
         EdgeIndex t1, t2;
@@ -180,19 +195,17 @@ namespace generators::helpers::polylla {
         }
 
     }
-    HalfEdgeMesh::EdgeIndex MeshHelper<HalfEdgeMesh>::calculateMiddleEdge(GeneratorData& data, const HalfEdgeMesh* inputMesh, VertexIndex barrierEdgeTipVertex) {
+    template <HalfEdgeMeshData MeshType>
+    typename MeshHelper<MeshType>::EdgeIndex MeshHelper<MeshType>::calculateMiddleEdge(GeneratorData& data, const MeshType* inputMesh, VertexIndex barrierEdgeTipVertex) {
         EdgeIndex frontierEdgeWithBarrierEdgeTip = getNextFrontierEdge(data,inputMesh,inputMesh->edgeOfVertex(barrierEdgeTipVertex));
         unsigned int numberOfInternalEdges = inputMesh->degree(barrierEdgeTipVertex) - 1; //internal-edges incident to v
-        unsigned int cwStepsUntilMiddleEdge = (numberOfInternalEdges - 1) / 2;
-        EdgeIndex nextCWEdge = inputMesh->CWEdgeToVertex(frontierEdgeWithBarrierEdgeTip);
+        unsigned int cwStepsUntilMiddleEdge = (numberOfInternalEdges - 1) / 2 + 1;
         //back to traversing the edges of v_barrier edge tip until the middle-edge is selected
-        while (cwStepsUntilMiddleEdge != 0){
-            nextCWEdge = inputMesh->CWEdgeToVertex(nextCWEdge);
-            --cwStepsUntilMiddleEdge;
-        }
-        return nextCWEdge;
+        auto edgesAroundTip = inputMesh->edgesAroundOriginCW(frontierEdgeWithBarrierEdgeTip);
+        return *std::ranges::next(edgesAroundTip.begin(), cwStepsUntilMiddleEdge);
     }
-    HalfEdgeMesh::OutputIndex MeshHelper<HalfEdgeMesh>::generateRepairedPolygon(GeneratorData& data, const HalfEdgeMesh* inputMesh, HalfEdgeMesh* outputMesh, OutputIndex seedToRepair) {
+    template <HalfEdgeMeshData MeshType>
+    typename MeshHelper<MeshType>::OutputIndex MeshHelper<MeshType>::generateRepairedPolygon(GeneratorData& data, const MeshType* inputMesh, MeshType* outputMesh, OutputIndex seedToRepair) {
         EdgeIndex firstEdge = seedToRepair;
 
         //search next frontier-edge
@@ -204,9 +204,9 @@
 template <MeshData Mesh>
 bool MinAngleCriterion<Mesh>::operator()(const Mesh* mesh, FaceIndex polygonIndex) const
 {
-    typename Mesh::VertexType v1;
-    typename Mesh::VertexType v2;
-    typename Mesh::VertexType v3;
+    Vertex v1;
+    Vertex v2;
+    Vertex v3;
 
     mesh->getVerticesOfTriangle(polygonIndex, v1, v2, v3);
 
@@ -251,3 +251,7 @@ bool MinAngleCriterion<Mesh>::operator()(const Mesh* mesh, FaceIndex polygonInde
     return cos2Signed > angleThreshold;
 }
 
+template <MeshData Mesh>
+bool MinAngleCriterion<Mesh>::operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const {
+    return cache.minAngleCos2[polygonIndex] > angleThreshold;
+}
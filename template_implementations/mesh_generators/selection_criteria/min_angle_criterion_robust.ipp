@@ -5,7 +5,7 @@
 template <MeshData Mesh>
 bool MinAngleCriterionRobust<Mesh>::operator()(const Mesh* mesh, FaceIndex polygonIndex) const {
     typename Mesh::EdgeIndex firstEdge = mesh->getPolygon(polygonIndex);
-    typename Mesh::VertexType v1, v2, v3;
+    Vertex v1, v2, v3;
 
     mesh->getVerticesOfTriangle(polygonIndex,v1,v2,v3);
     Vertex edgeV1V2 = v2 - v1;
@@ -19,4 +19,9 @@ bool MinAngleCriterionRobust<Mesh>::operator()(const Mesh* mesh, FaceIndex polyg
     double angle3 = std::acos(std::clamp((-edgeV2V3.dot(edgeV3V1)) / (std::sqrt(edgeV2V3.dot(edgeV2V3)) * std::sqrt(edgeV3V1.dot(edgeV3V1))), -1.0, 1.0));
 
     return std::min({angle1, angle2, angle3}) < angleThreshold;
+}
+
+template <MeshData Mesh>
+bool MinAngleCriterionRobust<Mesh>::operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const {
+    return cache.minAngle[polygonIndex] < angleThreshold;
 }
\ No newline at end of file
@@ -4,10 +4,15 @@
 
 template <MeshData Mesh>
 bool MinArea2Criterion<Mesh>::operator()(const Mesh* mesh, typename Mesh::FaceIndex polygonIndex) const {
-    typename Mesh::VertexType v1,v2,v3;
+    Vertex v1,v2,v3;
 
     mesh->getVerticesOfTriangle(polygonIndex, v1, v2, v3);
 
     double area = v1.cross2d(v2,v3);
     return area >= minArea2;
+}
+
+template <MeshData Mesh>
+bool MinArea2Criterion<Mesh>::operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const {
+    return cache.area2[polygonIndex] >= minArea2;
 }
\ No newline at end of file
@@ -4,10 +4,15 @@
 
 template <MeshData Mesh>
 bool MinAreaCriterion<Mesh>::operator()(const Mesh* mesh, FaceIndex polygonIndex) const {
-    typename Mesh::VertexType v1,v2,v3;
+    Vertex v1,v2,v3;
 
     mesh->getVerticesOfTriangle(polygonIndex, v1, v2, v3);
 
     double area = 0.5 * v1.cross2d(v2,v3);
     return area <= minArea;
+}
+
+template <MeshData Mesh>
+bool MinAreaCriterion<Mesh>::operator()(const TriangleQualityCache& cache, FaceIndex polygonIndex) const {
+    return cache.area(polygonIndex) <= minArea;
 }
\ No newline at end of file
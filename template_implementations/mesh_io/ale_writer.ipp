@@ -3,19 +3,21 @@
 #endif
 
 template <MeshData Mesh>
-inline void AleWriter<Mesh>::writeOutputSeeds(std::ofstream &file, HalfEdgeMesh &mesh, std::vector<HalfEdgeMesh::OutputIndex> outputSeeds) requires std::same_as<Mesh, HalfEdgeMesh> {
-    for(HalfEdgeMesh::EdgeIndex firstEdge : outputSeeds){
-        HalfEdgeMesh::EdgeIndex currentEdge = firstEdge;
-        std::vector<HalfEdgeMesh::VertexIndex> vertices;
+inline void AleWriter<Mesh>::writeOutputSeeds(std::ofstream &file, Mesh &mesh, std::vector<typename Mesh::OutputIndex> outputSeeds) requires HalfEdgeMeshData<Mesh> {
+    using EdgeIndex = typename Mesh::EdgeIndex;
+    using VertexIndex = typename Mesh::VertexIndex;
+    for(EdgeIndex firstEdge : outputSeeds){
+        EdgeIndex currentEdge = firstEdge;
+        std::vector<VertexIndex> vertices;
         vertices.reserve(3);
         do {
-            vertices.push_back(mesh.origin(currentEdge));
+            vertices.push_back(this->outputVertexId(mesh, mesh.origin(currentEdge)));
             currentEdge = mesh.next(currentEdge);
         } while(firstEdge != currentEdge);
 
         file << vertices.size() << " ";            
 
-        for (HalfEdgeMesh::VertexIndex vertIndex : vertices) {
+        for (VertexIndex vertIndex : vertices) {
             file << vertIndex << " ";
         }
         file << '\n'; 
@@ -23,8 +25,8 @@ inline void AleWriter<Mesh>::writeOutputSeeds(std::ofstream &file, HalfEdgeMesh
     //Print borderedges
     file <<"# indices of nodes located on the Dirichlet boundary\n";
     ///Find borderedges
-    HalfEdgeMesh::EdgeIndex borderCurrent, borderInitial = 0;
-    for(HalfEdgeMesh::EdgeIndex edgeIndex = mesh.numberOfEdges() - 1; edgeIndex != 0; --edgeIndex) {
+    EdgeIndex borderCurrent, borderInitial = 0;
+    for(EdgeIndex edgeIndex = mesh.numberOfEdges() - 1; edgeIndex != 0; --edgeIndex) {
         if(mesh.isBorderEdge(edgeIndex)){
             borderInitial = edgeIndex;
             break;
@@ -34,10 +36,10 @@ inline void AleWriter<Mesh>::writeOutputSeeds(std::ofstream &file, HalfEdgeMesh
             break;
         }
     }
-    file << mesh.origin(borderInitial) << " ";
+    file << this->outputVertexId(mesh, mesh.origin(borderInitial)) << " ";
     borderCurrent = mesh.prev(borderInitial);
     while(borderInitial != borderCurrent) {
-        file << mesh.origin(borderCurrent) << " ";
+        file << this->outputVertexId(mesh, mesh.origin(borderCurrent)) << " ";
         borderCurrent = mesh.prev(borderCurrent);
     }
     file << std::endl;
@@ -57,8 +59,9 @@ void AleWriter<Mesh>::writeMesh(const std::vector<std::filesystem::path>& files,
     double xmin = xmax;
     double ymax = mesh.getVertex(0).y;
     double ymin = ymax;
+    std::vector<typename Mesh::VertexIndex> vertexOrder = this->outputVertexOrder(mesh);
     for(typename Mesh::VertexIndex i = 0; i < numberOfVertices; ++i) {
-        typename Mesh::VertexType& vert = mesh.getVertex(i);
+        const typename Mesh::VertexType& vert = mesh.getVertex(vertexOrder.empty() ? i : vertexOrder[i]);
         xmax = vert.x > xmax ? vert.x : xmax;
         xmin = vert.x < xmin ? vert.x : xmin;
         ymax = vert.y > ymax ? vert.y : ymax;
@@ -0,0 +1,99 @@
+#ifndef BINARY_MESH_READER_HPP
+#include <mesh_io/binary_mesh_reader.hpp>
+#endif
+
+template <MeshData Mesh>
+template <typename T>
+std::vector<T> BinaryMeshReader<Mesh>::readArray(const MappedFile& file, size_t& offset, size_t count, const std::filesystem::path& filepath) {
+    size_t bytes = count * sizeof(T);
+    if (offset + bytes > file.size()) {
+        throw std::runtime_error("File: " + filepath.string() + " is truncated");
+    }
+    std::vector<T> records(count);
+    // Copying in parallel also faults the mapped pages in from several threads
+    parallel::forEachChunk(0, count, [&](size_t, size_t chunkBegin, size_t chunkEnd) {
+        std::memcpy(records.data() + chunkBegin, file.data() + offset + chunkBegin * sizeof(T), (chunkEnd - chunkBegin) * sizeof(T));
+    });
+    offset += binary_mesh_format::alignedSize(bytes);
+    return records;
+}
+
+template <MeshData Mesh>
+binary_mesh_format::Header BinaryMeshReader<Mesh>::readHeader(const MappedFile& file, const std::filesystem::path& filepath) {
+    if (file.size() < sizeof(binary_mesh_format::Header)) {
+        throw std::runtime_error("File: " + filepath.string() + " is too short to be a binary half edge mesh");
+    }
+    binary_mesh_format::Header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    binary_mesh_format::validateHeader<Index, Scalar>(header, filepath);
+    return header;
+}
+
+template <MeshData Mesh>
+std::vector<typename Mesh::FaceIndex> BinaryMeshReader<Mesh>::trianglesOf(const std::vector<BasicHalfEdge<Index>>& halfEdges, const std::vector<Index>& polygons, size_t nPolygons, const std::filesystem::path& filepath) {
+    std::vector<typename Mesh::FaceIndex> faces(3 * nPolygons);
+    std::atomic<bool> onlyTriangles = true;
+    parallel::forEachChunk(0, nPolygons, [&](size_t, size_t chunkBegin, size_t chunkEnd) {
+        for (size_t polygon = chunkBegin; polygon < chunkEnd; ++polygon) {
+            Index edge = polygons[polygon];
+            for (size_t j = 0; j < 3; ++j) {
+                faces[3 * polygon + j] = halfEdges[edge].origin;
+                edge = halfEdges[edge].next;
+            }
+            if (edge != polygons[polygon]) {
+                onlyTriangles.store(false, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (!onlyTriangles.load()) {
+        throw std::runtime_error("File: " + filepath.string() + " doesn't hold a triangulation, it can only be loaded into a mesh type that takes its records as they are");
+    }
+    return faces;
+}
+
+template <MeshData Mesh>
+Mesh* BinaryMeshReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& files) {
+    MappedFile file(files[0]);
+    binary_mesh_format::Header header = readHeader(file, files[0]);
+    size_t offset = binary_mesh_format::alignedSize(sizeof(binary_mesh_format::Header));
+    std::vector<BasicHEVertex<Index, Scalar>> vertexRecords = readArray<BasicHEVertex<Index, Scalar>>(file, offset, header.vertexRecords, files[0]);
+    std::vector<BasicHalfEdge<Index>> halfEdgeRecords = readArray<BasicHalfEdge<Index>>(file, offset, header.halfEdgeRecords, files[0]);
+    std::vector<Index> polygonRecords = readArray<Index>(file, offset, header.polygonRecords, files[0]);
+    std::vector<Index> originalVertexIds = readArray<Index>(file, offset, header.originalVertexIdRecords, files[0]);
+
+    if constexpr (HasRecordsConstructor<Mesh>
+                  && std::same_as<typename Mesh::VertexType, BasicHEVertex<Index, Scalar>>
+                  && std::same_as<typename Mesh::EdgeType, BasicHalfEdge<Index>>) {
+        HalfEdgeMeshRecords<typename Mesh::VertexType, typename Mesh::EdgeType, typename Mesh::FaceIndex> records{
+            .vertices = std::move(vertexRecords),
+            .halfEdges = std::move(halfEdgeRecords),
+            .polygons = std::move(polygonRecords),
+            .nVertices = header.nVertices,
+            .nHalfEdges = header.nHalfEdges,
+            .nPolygons = header.nPolygons
+        };
+        return this->withOriginalVertexIds(new Mesh(std::move(records)), std::move(originalVertexIds));
+    } else {
+        std::vector<typename Mesh::FaceIndex> faces = trianglesOf(halfEdgeRecords, polygonRecords, header.nPolygons, files[0]);
+        halfEdgeRecords = std::vector<BasicHalfEdge<Index>>();
+        std::vector<typename Mesh::VertexType> vertices(header.nVertices);
+        parallel::forEach(0, vertices.size(), [&](size_t v) {
+            vertices[v].x = vertexRecords[v].x;
+            vertices[v].y = vertexRecords[v].y;
+            if constexpr (IsHalfEdgeVertex<typename Mesh::VertexType>) {
+                vertices[v].isBorder = vertexRecords[v].isBorder;
+            }
+        });
+        std::vector<typename Mesh::EdgeType> edges;
+        return this->withOriginalVertexIds(new Mesh(vertices, edges, faces), std::move(originalVertexIds));
+    }
+}
+
+template <MeshData Mesh>
+MeshSize BinaryMeshReader<Mesh>::readMeshSize(const std::vector<std::filesystem::path>& files) {
+    binary_mesh_format::Header header = binary_mesh_format::readHeader(files[0]);
+    return MeshSize{
+        .nVertices = header.nVertices,
+        .nTriangles = header.nPolygons
+    };
+}
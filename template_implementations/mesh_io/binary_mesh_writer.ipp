@@ -0,0 +1,100 @@
+#ifndef BINARY_MESH_WRITER_HPP
+#include <mesh_io/binary_mesh_writer.hpp>
+#endif
+
+template <MeshData Mesh>
+template <typename T>
+inline void BinaryMeshWriter<Mesh>::writeArray(std::ofstream& file, const T* data, size_t count) {
+    size_t bytes = count * sizeof(T);
+    file.write(reinterpret_cast<const char*>(data), bytes);
+    static constexpr char padding[binary_mesh_format::alignment] = {};
+    file.write(padding, binary_mesh_format::alignedSize(bytes) - bytes);
+}
+
+template <MeshData Mesh>
+template <typename T, typename RecordFunction>
+inline void BinaryMeshWriter<Mesh>::writeRecords(std::ofstream& file, size_t count, RecordFunction makeRecord) {
+    constexpr size_t blockSize = 1 << 16;
+    // Whole blocks keep the file aligned, so only the last one needs padding
+    static_assert((blockSize * sizeof(T)) % binary_mesh_format::alignment == 0);
+    std::vector<T> block;
+    block.reserve(std::min(count, blockSize));
+    for (size_t i = 0; i < count; ++i) {
+        block.push_back(makeRecord(i));
+        if (block.size() == blockSize) {
+            file.write(reinterpret_cast<const char*>(block.data()), block.size() * sizeof(T));
+            block.clear();
+        }
+    }
+    writeArray(file, block.data(), block.size());
+}
+
+template <MeshData Mesh>
+inline void BinaryMeshWriter<Mesh>::writeVertices(std::ofstream& file, Mesh& mesh) requires HalfEdgeMeshData<Mesh> {
+    using VertexRecord = BasicHEVertex<Index, Scalar>;
+    if constexpr (std::same_as<typename Mesh::VertexType, VertexRecord> && requires { mesh.getVertexRecords(); }) {
+        writeArray(file, mesh.getVertexRecords().data(), mesh.getVertexVectorSize());
+    } else {
+        writeRecords<VertexRecord>(file, mesh.getVertexVectorSize(), [&mesh](size_t v) {
+            VertexRecord record{};
+            const typename Mesh::VertexType& vertex = mesh.getVertex(v);
+            record.x = vertex.x;
+            record.y = vertex.y;
+            record.incidentHalfEdge = mesh.edgeOfVertex(v);
+            record.isBorder = vertex.isBorder;
+            return record;
+        });
+    }
+}
+
+template <MeshData Mesh>
+inline void BinaryMeshWriter<Mesh>::writeHalfEdges(std::ofstream& file, Mesh& mesh) requires HalfEdgeMeshData<Mesh> {
+    using HalfEdgeRecord = BasicHalfEdge<Index>;
+    if constexpr (std::same_as<typename Mesh::EdgeType, HalfEdgeRecord> && requires { mesh.getHalfEdgeRecords(); }) {
+        writeArray(file, mesh.getHalfEdgeRecords().data(), mesh.getEdgeVectorSize());
+    } else {
+        writeRecords<HalfEdgeRecord>(file, mesh.getEdgeVectorSize(), [&mesh](size_t e) {
+            HalfEdgeRecord record{};
+            record.origin = mesh.origin(e);
+            record.twin = mesh.twin(e);
+            record.next = mesh.next(e);
+            record.prev = mesh.prev(e);
+            record.face = mesh.getFaceOfEdge(e);
+            record.isBorder = mesh.isBorderEdge(e);
+            return record;
+        });
+    }
+}
+
+template <MeshData Mesh>
+void BinaryMeshWriter<Mesh>::writeMesh(const std::vector<std::filesystem::path>& files, Mesh& mesh, std::vector<typename Mesh::OutputIndex> outputSeeds) {
+    std::ofstream file(files[0], std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("File: " + files[0].string() + " cannot be opened for writing");
+    }
+    binary_mesh_format::Header header = binary_mesh_format::makeHeader<Index, Scalar>();
+    header.nVertices = mesh.numberOfVertices();
+    header.nHalfEdges = mesh.numberOfEdges();
+    header.nPolygons = mesh.numberOfPolygons();
+    header.vertexRecords = mesh.getVertexVectorSize();
+    header.halfEdgeRecords = mesh.getEdgeVectorSize();
+    header.polygonRecords = mesh.getFaceVectorSize();
+    header.originalVertexIdRecords = mesh.hasOriginalVertexIds() ? header.vertexRecords : 0;
+    header.outputSeedRecords = outputSeeds.size();
+    writeArray(file, &header, 1);
+
+    writeVertices(file, mesh);
+    writeHalfEdges(file, mesh);
+    if constexpr (requires { mesh.getPolygonRecords(); }) {
+        writeArray(file, mesh.getPolygonRecords().data(), header.polygonRecords);
+    } else {
+        writeRecords<Index>(file, header.polygonRecords, [&mesh](size_t f) {
+            return static_cast<Index>(mesh.getPolygon(f));
+        });
+    }
+    writeRecords<Index>(file, header.originalVertexIdRecords, [&mesh](size_t v) {
+        return static_cast<Index>(mesh.originalVertexId(v));
+    });
+    writeArray(file, outputSeeds.data(), outputSeeds.size());
+    file.close();
+}
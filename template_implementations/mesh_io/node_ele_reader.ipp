@@ -22,9 +22,9 @@ std::vector<std::filesystem::path> NodeEleReader<Mesh>::parsePaths(const std::ve
 }
 
 template <MeshData Mesh>
-unsigned int NodeEleReader<Mesh>::readNodeFile(const std::filesystem::path& filepath, std::vector<typename Mesh::VertexType> &vertices)
+size_t NodeEleReader<Mesh>::readNodeFile(const std::filesystem::path& filepath, std::vector<typename Mesh::VertexType> &vertices)
 {
-    unsigned int n_vertices = 0;
+    size_t n_vertices = 0;
     unsigned int discard = 0; // to skip values
     unsigned int n_attributes = 0;
     unsigned int hasBoundaryMarkers = 0;
@@ -40,7 +40,8 @@ unsigned int NodeEleReader<Mesh>::readNodeFile(const std::filesystem::path& file
                 continue;
             }
             std::istringstream stream(line);
-            int nodeNumber, boundary;
+            typename Mesh::VertexIndex nodeNumber;
+            int boundary;
             double xCoord, yCoord;
             unsigned int attributesOfThisNode = n_attributes;
             stream >> nodeNumber >> xCoord >> yCoord;
@@ -70,46 +71,48 @@ Mesh* NodeEleReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& fi
 
     // Read vertices
     std::vector<typename Mesh::VertexType> vertices;
-    unsigned int n_vertices = readNodeFile(parsedPaths[0], vertices);
+    readNodeFile(parsedPaths[0], vertices);
 
     // Read faces
-    std::vector<int> faces;
-    unsigned int n_elements = readEleFile(parsedPaths[1], faces);
+    std::vector<typename Mesh::FaceIndex> faces;
+    size_t n_elements = readEleFile(parsedPaths[1], faces);
 
     // Prepare empty edge container
     std::vector<typename Mesh::EdgeType> edges;
 
     Mesh* resultMesh;
+    std::vector<typename Mesh::FaceIndex> neighbors;
     // Handle adjacency construction if supported
     if constexpr (HasAdjacencyConstructor<Mesh>) {
-        std::vector<int> neighbors;
         if (std::filesystem::exists(parsedPaths[2])) {
-            unsigned int n_border_edges = readNeighFile(parsedPaths[2], neighbors);
-            edges.reserve(3 * n_vertices - 3 - n_border_edges);
+            // The mesh sizes its half edges from the faces and neighbors, so `edges` isn't reserved here
+            readNeighFile(parsedPaths[2], neighbors);
+            std::vector<typename Mesh::VertexIndex> originalVertexIds = this->reorderSpatially(vertices, faces, neighbors);
             resultMesh = new Mesh(vertices, edges, faces, neighbors);
-            return resultMesh;
+            return this->withOriginalVertexIds(resultMesh, std::move(originalVertexIds));
         }
     }
+    std::vector<typename Mesh::VertexIndex> originalVertexIds = this->reorderSpatially(vertices, faces, neighbors);
     resultMesh = new Mesh(vertices, edges, faces);
     // Default mesh construction
-    return resultMesh;
+    return this->withOriginalVertexIds(resultMesh, std::move(originalVertexIds));
 }
 
 
 template <MeshData Mesh>
-unsigned int NodeEleReader<Mesh>::readNeighFile(const std::filesystem::path &filepath, std::vector<int> &neighbors) {
+size_t NodeEleReader<Mesh>::readNeighFile(const std::filesystem::path &filepath, std::vector<typename Mesh::FaceIndex> &neighbors) {
     
         std::string line;
         std::ifstream neighfile(filepath);
-        unsigned int n_border_edges;
+        size_t n_border_edges = 0;
         if (neighfile.is_open()) {
-            unsigned int n_faces;
+            size_t n_faces;
             neighfile >> n_faces;
 
             neighbors.reserve(3*n_faces);
             std::getline(neighfile, line); //skip the first line
             while (std::getline(neighfile, line)) {
-                int triangleNumber, neighbor1, neighbor2, neighbor3;
+                typename Mesh::FaceIndex triangleNumber, neighbor1, neighbor2, neighbor3;
                 if(line[0] == '#'){
                     continue;
                 }
@@ -138,10 +141,10 @@ unsigned int NodeEleReader<Mesh>::readNeighFile(const std::filesystem::path &fil
 }
 
 template <MeshData Mesh>
-unsigned int NodeEleReader<Mesh>::readEleFile(const std::filesystem::path &filepath, std::vector<int> &faces) {
+size_t NodeEleReader<Mesh>::readEleFile(const std::filesystem::path &filepath, std::vector<typename Mesh::FaceIndex> &faces) {
     std::string line;
     std::ifstream elefile(filepath);
-    unsigned int n_elements;
+    size_t n_elements;
 
     if (elefile.is_open()) {
         elefile >> n_elements;
@@ -152,7 +155,7 @@ unsigned int NodeEleReader<Mesh>::readEleFile(const std::filesystem::path &filep
             if(line[0] == '#'){
                 continue;
             }
-            int triangleNumber, node1, node2, node3;
+            typename Mesh::FaceIndex triangleNumber, node1, node2, node3;
             std::istringstream(line) >> triangleNumber >> node1 >> node2 >> node3;
             faces.push_back(node1);
             faces.push_back(node2);
@@ -166,3 +169,22 @@ unsigned int NodeEleReader<Mesh>::readEleFile(const std::filesystem::path &filep
     return n_elements;
 }
 
+template <MeshData Mesh>
+size_t NodeEleReader<Mesh>::readHeaderCount(const std::filesystem::path& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("File: " + filepath.string() + " cannot be opened (does it exist?)");
+    }
+    size_t count = 0;
+    file >> count;
+    return count;
+}
+
+template <MeshData Mesh>
+MeshSize NodeEleReader<Mesh>::readMeshSize(const std::vector<std::filesystem::path>& files) {
+    std::vector<std::filesystem::path> parsedPaths = parsePaths(files);
+    return MeshSize{
+        .nVertices = readHeaderCount(parsedPaths[0]),
+        .nTriangles = readHeaderCount(parsedPaths[1])
+    };
+}
@@ -7,7 +7,7 @@ Mesh* OffReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& filepa
     //Read the OFF file
     std::vector<typename Mesh::VertexType> vertices;
     std::vector<typename Mesh::EdgeType> edges;
-    std::vector<int> faces;
+    std::vector<typename Mesh::FaceIndex> faces;
     size_t nVertices, nFaces, nEdges;
     std::string line;
     std::ifstream offFile(filepaths[0]);
@@ -39,7 +39,7 @@ Mesh* OffReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& filepa
             }
         }
         //Read vertices
-        int index = 0;
+        size_t index = 0;
         while (index < nVertices && std::getline(offFile, line)) {
             std::istringstream(line) >> tmp;
             // std::cout<<"tmp: "<<tmp<<std::endl;
@@ -53,7 +53,8 @@ Mesh* OffReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& filepa
             }
         }
         //Read faces
-        int length, t1, t2, t3;
+        int length;
+        typename Mesh::VertexIndex t1, t2, t3;
         index = 0;
         while (index < nFaces && std::getline(offFile, line)) {
             std::istringstream(line) >> tmp;
@@ -61,7 +62,7 @@ Mesh* OffReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& filepa
             if (tmp[0] != '#' && !MeshReader<Mesh>::isWhitespace(line)) {
                 std::istringstream(line) >> length >> t1 >> t2 >> t3;
                 // CHECK ORIENTATION!!
-                if (vertices[t1].cross2d(vertices[t2],vertices[t3]) > 0) {
+                if (Mesh::VertexType::orient2d(vertices[t1],vertices[t2],vertices[t3]) > 0) {
                     faces.push_back(t1);
                     faces.push_back(t2);
                     faces.push_back(t3);
@@ -79,6 +80,31 @@ Mesh* OffReader<Mesh>::readMesh(const std::vector<std::filesystem::path>& filepa
     }
     offFile.close();
     edges.reserve(3* nVertices);
+    std::vector<typename Mesh::FaceIndex> neighbors;
+    std::vector<typename Mesh::VertexIndex> originalVertexIds = this->reorderSpatially(vertices, faces, neighbors);
     Mesh* resultMesh = new Mesh(vertices, edges, faces);
-    return resultMesh;
+    return this->withOriginalVertexIds(resultMesh, std::move(originalVertexIds));
+}
+
+template <MeshData Mesh>
+MeshSize OffReader<Mesh>::readMeshSize(const std::vector<std::filesystem::path>& filepaths) {
+    MeshSize size{0, 0};
+    std::string line;
+    std::string tmp;
+    std::ifstream offFile(filepaths[0]);
+    if (!offFile.is_open()) {
+        throw std::runtime_error("File: " + filepaths[0].string() + " cannot be opened (does it exist?)");
+    }
+    bool foundHeader = false;
+    while (std::getline(offFile, line)) {
+        std::istringstream(line) >> tmp;
+        if (tmp[0] != '#' && !MeshReader<Mesh>::isWhitespace(line)) {
+            if (foundHeader) {
+                std::istringstream(line) >> size.nVertices >> size.nTriangles;
+                break;
+            }
+            foundHeader = true;
+        }
+    }
+    return size;
 }
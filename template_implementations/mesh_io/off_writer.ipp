@@ -3,21 +3,22 @@
 #endif
 
 template <MeshData Mesh>
-inline void OffWriter<Mesh>::writeFaces(std::ofstream& file, HalfEdgeMesh &mesh) requires std::same_as<Mesh, HalfEdgeMesh> {
-    std::unordered_map<int, std::vector<int>> edgesOfFace;
-    for (int i = 0; i < mesh.numberOfEdges(); ++i) {
-        const HalfEdge& he = mesh.getEdge(i);
-        if (he.origin == -1) continue;
+inline void OffWriter<Mesh>::writeFaces(std::ofstream& file, Mesh &mesh) requires HalfEdgeMeshData<Mesh> {
+    using EdgeIndex = typename Mesh::EdgeIndex;
+    using FaceIndex = typename Mesh::FaceIndex;
+    std::unordered_map<FaceIndex, std::vector<EdgeIndex>> edgesOfFace;
+    for (EdgeIndex i = 0; i < mesh.numberOfEdges(); ++i) {
+        if (mesh.origin(i) == Mesh::invalidIndexValue) continue;
 
-        edgesOfFace.try_emplace(he.face).first->second.push_back(i);
+        edgesOfFace.try_emplace(mesh.getFaceOfEdge(i)).first->second.push_back(i);
     }
     for (const auto& faceEdgesPair : edgesOfFace) {
-        const std::vector<int>& edges = faceEdgesPair.second;
+        const std::vector<EdgeIndex>& edges = faceEdgesPair.second;
         file << edges.size() << " ";
-        int firstEdge = edges[0];
-        int currentEdge = firstEdge;
+        EdgeIndex firstEdge = edges[0];
+        EdgeIndex currentEdge = firstEdge;
         do {
-            file << mesh.origin(currentEdge) << " ";
+            file << this->outputVertexId(mesh, mesh.origin(currentEdge)) << " ";
             currentEdge = mesh.next(currentEdge);
         } while (currentEdge != firstEdge);
         file << '\n';
@@ -37,8 +38,9 @@ inline void OffWriter<Mesh>::writeMesh(const std::vector<std::filesystem::path>&
         out << mesh.numberOfPolygons();
     }
     out << " 0\n";
+    std::vector<typename Mesh::VertexIndex> vertexOrder = this->outputVertexOrder(mesh);
     for (size_t i = 0; i < mesh.numberOfVertices(); ++i) {
-        Vertex v = mesh.getVertex(i);
+        Vertex v = mesh.getVertex(vertexOrder.empty() ? i : vertexOrder[i]);
         out << v.x << " " << v.y << " 0\n";
     }
     if (hasOutput) {
@@ -50,15 +52,15 @@ inline void OffWriter<Mesh>::writeMesh(const std::vector<std::filesystem::path>&
 }
 
 template <MeshData Mesh>
-inline void OffWriter<Mesh>::writeOutputSeeds(std::ofstream &file, HalfEdgeMesh &mesh, std::vector<HalfEdgeMesh::OutputIndex> outputSeeds) requires std::same_as<Mesh, HalfEdgeMesh> {
-    using EdgeIndex = HalfEdgeMesh::EdgeIndex;
-    using VertexIndex = HalfEdgeMesh::VertexIndex;
+inline void OffWriter<Mesh>::writeOutputSeeds(std::ofstream &file, Mesh &mesh, std::vector<typename Mesh::OutputIndex> outputSeeds) requires HalfEdgeMeshData<Mesh> {
+    using EdgeIndex = typename Mesh::EdgeIndex;
+    using VertexIndex = typename Mesh::VertexIndex;
     for (EdgeIndex firstEdge : outputSeeds) {
         std::vector<VertexIndex> vertices;
         vertices.reserve(3);
         EdgeIndex currentEdge = firstEdge;
         do {
-            vertices.push_back(mesh.origin(currentEdge));
+            vertices.push_back(this->outputVertexId(mesh, mesh.origin(currentEdge)));
             currentEdge = mesh.next(currentEdge);
         } while (currentEdge != firstEdge);
 
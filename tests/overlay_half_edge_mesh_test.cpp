@@ -0,0 +1,46 @@
+#include <iostream>
+#include <vector>
+#include <mesh_data/half_edge_mesh.hpp>
+#include <mesh_data/overlay_half_edge_mesh.hpp>
+
+/**
+ * Checks that `getEdge` of an overlay assembles the same half edge its accessors return, both for the edges it reads
+ * from the base mesh and for the ones it overrides
+ */
+template <HalfEdgeMeshData Mesh>
+bool edgesMatchAccessors(const Mesh& mesh) {
+    for (typename Mesh::EdgeIndex e = 0; e < static_cast<typename Mesh::EdgeIndex>(mesh.numberOfEdges()); ++e) {
+        typename Mesh::EdgeType edge = mesh.getEdge(e);
+        if (edge.origin != mesh.origin(e) || edge.twin != mesh.twin(e) || edge.next != mesh.next(e)
+            || edge.prev != mesh.prev(e) || edge.face != mesh.getFaceOfEdge(e) || edge.isBorder != mesh.isBorderEdge(e)) {
+            std::cerr << "getEdge(" << e << ") doesn't match the accessors of the mesh" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::vector<HEVertex> vertices(4);
+    vertices[0].x = 0.0; vertices[0].y = 0.0;
+    vertices[1].x = 1.0; vertices[1].y = 0.0;
+    vertices[2].x = 1.0; vertices[2].y = 1.0;
+    vertices[3].x = 0.0; vertices[3].y = 1.0;
+    OverlayHalfEdgeMesh input(vertices, {}, {0, 1, 2, 0, 2, 3});
+    OverlayHalfEdgeMesh output(input);
+    // Merge both triangles into a quad through their shared edge, as inserting a cavity would
+    OverlayHalfEdgeMesh::EdgeIndex shared = 0;
+    while (output.isBorderEdge(shared)) {
+        ++shared;
+    }
+    OverlayHalfEdgeMesh::EdgeIndex twin = output.twin(shared);
+    output.setNext(output.prev(shared), output.next(twin));
+    output.setPrev(output.next(twin), output.prev(shared));
+    output.setNext(output.prev(twin), output.next(shared));
+    output.setPrev(output.next(shared), output.prev(twin));
+    output.setFaceToEdge(output.getFaceOfEdge(shared), output.next(shared));
+
+    bool passed = edgesMatchAccessors(input) && edgesMatchAccessors(output) && output.getEdge(shared) == input.getEdge(shared);
+    std::cout << (passed ? "passed" : "failed") << std::endl;
+    return passed ? 0 : 1;
+}